@@ -0,0 +1,99 @@
+/* advisor.c: Suggesting moves to the player.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include "yahtzee.h"
+#include "solver.h"
+#include "distribution.h"
+#include "target.h"
+#include "solution.h"
+#include "advisor.h"
+
+/* The current objective, and the target score.
+ */
+static int objective = objective_expectedscore;
+static int targetscore = 0;
+
+/* Change the objective.
+ */
+void setobjective(int newobjective, int target)
+{
+    objective = newobjective;
+    targetscore = target;
+}
+
+/* Read the state of the game from the controls and find the best
+ * move. The used categories are the disabled slots, and the subtotal
+ * is capped at 63 as in the solution. When aiming for a target
+ * without a target table, the distribution table is used instead if
+ * it is loaded. Either way, the advice falls back to maximizing the
+ * expected score once the target has been reached or can no longer
+ * be.
+ */
+int getadvice(struct game const *game, int *rerolls)
+{
+    struct control const *controls = game->controls;
+    unsigned char dice[ctl_dice_count];
+    int mask, subtotal, score, needed, keep, c, i;
+
+    mask = 0;
+    subtotal = 0;
+    score = 0;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (!isdisabled(controls[categoryslots[c]]))
+	    continue;
+	mask |= 1 << c;
+	if (c < 6)
+	    subtotal += controls[categoryslots[c]].value;
+	score += controls[categoryslots[c]].value;
+    }
+    if (subtotal >= 63) {
+	subtotal = 63;
+	score += 35;
+    }
+    if (mask == categorymask_count - 1)
+	return -1;
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	dice[i] = controls[ctl_dice + i].value;
+
+    needed = targetscore - score;
+    if (objective == objective_targetscore && targets && needed > 0
+		&& targetodds(targets, mask, subtotal, needed) > 0.0) {
+	if (game->rollcount < 3) {
+	    keep = choosetargetkeep(targets, mask, subtotal, needed,
+				    dice, 3 - game->rollcount);
+	    if (keep != (1 << ctl_dice_count) - 1) {
+		*rerolls = ~keep & ((1 << ctl_dice_count) - 1);
+		return ctl_button;
+	    }
+	}
+	return categoryslots[choosetargetcategory(targets, mask, subtotal,
+						  needed, dice)];
+    }
+    if (objective == objective_targetscore && !targets && distributions
+		&& needed > 0
+		&& scorecdf(distributions, mask, subtotal, needed - 1) < 1.0) {
+	if (game->rollcount < 3) {
+	    keep = choosereachkeep(distributions, mask, subtotal, needed,
+				   dice, 3 - game->rollcount);
+	    if (keep != (1 << ctl_dice_count) - 1) {
+		*rerolls = ~keep & ((1 << ctl_dice_count) - 1);
+		return ctl_button;
+	    }
+	}
+	return categoryslots[choosereachcategory(distributions, mask,
+						 subtotal, needed, dice)];
+    }
+
+    if (game->rollcount < 3) {
+	keep = choosekeep(solution, mask, subtotal, dice, 3 - game->rollcount);
+	if (keep != (1 << ctl_dice_count) - 1) {
+	    *rerolls = ~keep & ((1 << ctl_dice_count) - 1);
+	    return ctl_button;
+	}
+    }
+    return categoryslots[choosecategory(solution, mask, subtotal, dice)];
+}
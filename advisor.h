@@ -0,0 +1,37 @@
+/* advisor.h: Suggesting moves to the player.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _advisor_h_
+#define _advisor_h_
+
+/* The objectives that the advice can pursue: the highest expected
+ * score, or the best chance of reaching a target score.
+ */
+enum { objective_expectedscore, objective_targetscore };
+
+/* Change the objective of the advice. The target is the final score
+ * to aim for, and is ignored for objective_expectedscore. Advice for
+ * a target uses the target table if it is loaded. Otherwise it uses
+ * the distribution table, looking one turn ahead and assuming that
+ * later turns are played for the expected score, and with neither
+ * table it is the same as for the expected score. The objective can
+ * be changed at any point during a game.
+ */
+extern void setobjective(int objective, int target);
+
+/* Determine the move that optimal play would make from the current
+ * state of a game's controls and the number of times the dice have
+ * been rolled so far this turn. If the dice should be
+ * rerolled, the return value is ctl_button, and the dice to reroll
+ * are marked in the bitmask stored in rerolls. Otherwise the return
+ * value is the slot in which to score the dice. The move is taken
+ * from the loaded solution if there is one, and is otherwise worked
+ * out by the lazy solver. The return value is -1 if every slot has
+ * been used.
+ */
+extern int getadvice(struct game const *game, int *rerolls);
+
+#endif
@@ -0,0 +1,361 @@
+/* bench.c: Throughput benchmarks for the scoring code and the
+ * transition matrix.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "hand.h"
+#include "tables.h"
+#include "scoring.h"
+#include "transitions.h"
+#include "solver.h"
+#include "rng.h"
+#include "position.h"
+
+/* The number of hands to score in each pass, and the number of
+ * passes to time.
+ */
+#define	bench_handcount		(1 << 20)
+#define	bench_passcount		64
+
+/* The number of times to evaluate the transition matrix.
+ */
+#define	bench_matrixcount	(1 << 16)
+
+/* The number of games to pack into positions and unpack again in
+ * each pass.
+ */
+#define	bench_gamecount		(1 << 16)
+
+/* The size of the buffer of dice, the number of times to fill it for
+ * timing, and the number of times to fill it for the chi-square test
+ * (a little over four billion dice).
+ */
+#define	bench_dicecount		(1 << 22)
+#define	bench_dicepasses	64
+#define	bench_chisquarepasses	1024
+
+/* The names of the scorehands() implementations.
+ */
+static char const *methodnames[scoring_count] = { "scalar", "sse2", "avx2" };
+
+/* The names of the expectkeeps() implementations.
+ */
+static char const *transitionnames[transitions_count] = {
+    "keeps scalar", "keeps sse2", "keeps avx2"
+};
+
+/* The names of the rngfill() implementations.
+ */
+static char const *rngfillnames[rngfill_count] = {
+    "dice scalar", "dice avx2"
+};
+
+/* Return the current time in seconds.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Score the hands one at a time through updateopenslots(), storing
+ * the results in the same layout as scorehands().
+ */
+static void scoreviacontrols(unsigned char const (*hands)[ctl_dice_count],
+			     unsigned char (*scores)[ctl_slots_count],
+			     int count)
+{
+    struct game game;
+    int n, i;
+
+    resetscores(&game);
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
+	game.controls[i].value = -1;
+	game.controls[i].flags = ctlflag_disabled;
+    }
+    for (i = ctl_slot_ones ; i <= ctl_slot_sixes ; ++i)
+	game.controls[i].flags = 0;
+    for (i = ctl_slot_threeofakind ; i <= ctl_slot_chance ; ++i)
+	game.controls[i].flags = 0;
+    for (n = 0 ; n < count ; ++n) {
+	for (i = 0 ; i < ctl_dice_count ; ++i) {
+	    game.controls[ctl_dice + i].value = hands[n][i];
+	    game.controls[ctl_dice + i].flags = ctlflag_modified;
+	}
+	updateopenslots(&game);
+	for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	    scores[n][i - ctl_slots] = isdisabled(game.controls[i])
+						? 0 : game.controls[i].value;
+    }
+}
+
+/* Compute the value of each keep directly from the list of keeps,
+ * adding up the terms in the same order as the transition matrix.
+ */
+static void expectkeepsdirectly(double const *handvalues, double *keepvalues)
+{
+    double sum;
+    int k, r;
+
+    for (k = 0 ; k < keep_count ; ++k) {
+	sum = 0.0;
+	for (r = 0 ; r < keep_count ; ++r)
+	    if (keepsizes[k] + keepsizes[r] == ctl_dice_count)
+		sum += rollodds[r]
+		     * handvalues[handindex(keeplist[k] + keeplist[r])];
+	keepvalues[k] = sum;
+    }
+}
+
+/* Return the probability that a chi-square statistic with five
+ * degrees of freedom is at least x.
+ */
+static double chisquareodds(double x)
+{
+    return erfc(sqrt(x / 2)) + sqrt(2 * x / M_PI) * exp(-x / 2) * (1 + x / 3);
+}
+
+/* Time rolling dice five at a time with rngdice(), as the game does,
+ * and then in bulk with each available implementation of rngfill(),
+ * checking that they all produce the same dice. Then count the faces
+ * of several billion dice and check that they are evenly distributed.
+ */
+static void benchdice(void)
+{
+    unsigned char *dice, *expected;
+    unsigned long long counts[6];
+    struct rng rng;
+    struct rngbatch batch;
+    double t, total, chisquare, odds;
+    int method, n, i;
+
+    dice = allocate(bench_dicecount);
+    expected = allocate(bench_dicecount);
+
+    rngseed(&rng, 1, 0);
+    t = now();
+    for (i = 0 ; i < bench_dicepasses ; ++i)
+	for (n = 0 ; n + ctl_dice_count <= bench_dicecount ;
+						n += ctl_dice_count)
+	    rngdice(&rng, dice + n, ctl_dice_count);
+    t = now() - t;
+    printf("%-16s %12.0f dice/sec\n", "rngdice",
+	   bench_dicepasses * (double)bench_dicecount / t);
+
+    for (method = 0 ; method < rngfill_count ; ++method) {
+	if (!selectrngfill(method)) {
+	    printf("%-16s  unavailable\n", rngfillnames[method]);
+	    continue;
+	}
+	rngseed(&rng, 1, 0);
+	rngbatchseed(&batch, &rng);
+	rngfill(&batch, dice, bench_dicecount);
+	if (method == rngfill_scalar)
+	    memcpy(expected, dice, bench_dicecount);
+	else if (memcmp(dice, expected, bench_dicecount))
+	    croak("%s: results do not match the scalar dice",
+		  rngfillnames[method]);
+	t = now();
+	for (i = 0 ; i < bench_dicepasses ; ++i)
+	    rngfill(&batch, dice, bench_dicecount);
+	t = now() - t;
+	printf("%-16s %12.0f dice/sec\n", rngfillnames[method],
+	       bench_dicepasses * (double)bench_dicecount / t);
+    }
+
+    memset(counts, 0, sizeof counts);
+    for (i = 0 ; i < bench_chisquarepasses ; ++i) {
+	rngfill(&batch, dice, bench_dicecount);
+	for (n = 0 ; n < bench_dicecount ; ++n)
+	    ++counts[dice[n]];
+    }
+    total = bench_chisquarepasses * (double)bench_dicecount;
+    chisquare = 0.0;
+    for (n = 0 ; n < 6 ; ++n)
+	chisquare += (counts[n] - total / 6) * (counts[n] - total / 6)
+		   / (total / 6);
+    odds = chisquareodds(chisquare);
+    printf("%-16s %12.3f over %.0f dice, p = %.3f\n", "dice chi-square",
+	   chisquare, total, odds);
+    if (odds < 0.0001)
+	croak("the dice are not evenly distributed");
+
+    free(dice);
+    free(expected);
+}
+
+/* Set up a random game that could come up in play. Each category is
+ * used with even odds, and scored with a random hand; then the dice
+ * are rolled, and a random category is selected if it is open.
+ */
+static void randomgame(struct game *game, struct rng *rng)
+{
+    int slot, c, i;
+
+    resetscores(game);
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
+	game->controls[i].key = 0;
+	game->controls[i].value = -1;
+	game->controls[i].flags = ctlflag_disabled;
+    }
+    for (c = 0 ; c < category_count ; ++c) {
+	slot = categoryslots[c];
+	game->controls[slot].key = 'a' + c;
+	game->controls[slot].flags = 0;
+	if (rngbelow(rng, 2)) {
+	    game->controls[slot].value =
+		handscores[rngbelow(rng, hand_count)][slot - ctl_slots];
+	    game->controls[slot].flags = ctlflag_disabled;
+	    markslotused(game, slot);
+	}
+    }
+    game->rollcount = 1 + rngbelow(rng, 3);
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+	game->controls[i].value = rngdie(rng);
+	game->controls[i].flags = ctlflag_modified;
+    }
+    updateopenslots(game);
+    slot = categoryslots[rngbelow(rng, category_count)];
+    if (!isdisabled(game->controls[slot])) {
+	game->controls[slot].flags |= ctlflag_selected;
+	markslotselected(game, slot);
+    }
+    updatescores(game);
+}
+
+/* Time the packing of many random games into positions and the
+ * unpacking of them again, and check that unpacking a position gives
+ * back the same score sheet and packs to the same position.
+ */
+static void benchpositions(void)
+{
+    struct game *games;
+    struct game game;
+    struct rng rng;
+    position *positions;
+    double t;
+    int n, i;
+
+    games = allocate(bench_gamecount * sizeof *games);
+    positions = allocate(bench_gamecount * sizeof *positions);
+    rngseed(&rng, 1, 0);
+    for (n = 0 ; n < bench_gamecount ; ++n)
+	randomgame(&games[n], &rng);
+
+    t = now();
+    for (i = 0 ; i < bench_passcount ; ++i)
+	for (n = 0 ; n < bench_gamecount ; ++n)
+	    positions[n] = packposition(&games[n]);
+    t = now() - t;
+    printf("%-16s %12.0f games/sec\n", "pack positions",
+	   bench_passcount * (double)bench_gamecount / t);
+
+    game = games[0];
+    t = now();
+    for (i = 0 ; i < bench_passcount ; ++i)
+	for (n = 0 ; n < bench_gamecount ; ++n)
+	    unpackposition(&game, positions[n]);
+    t = now() - t;
+    printf("%-16s %12.0f games/sec\n", "unpack positions",
+	   bench_passcount * (double)bench_gamecount / t);
+
+    for (n = 0 ; n < bench_gamecount ; ++n) {
+	unpackposition(&game, positions[n]);
+	if (packposition(&game) != positions[n])
+	    croak("game %d: position does not survive unpacking", n);
+	for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	    if (game.controls[i].value != games[n].controls[i].value
+			|| isselected(game.controls[i])
+				!= isselected(games[n].controls[i])
+			|| isdisabled(game.controls[i])
+				!= isdisabled(games[n].controls[i]))
+		croak("game %d: unpacking does not restore the slots", n);
+    }
+
+    free(games);
+    free(positions);
+}
+
+/* Time the scoring of many random hands with each available
+ * implementation, and check that they all agree with the results of
+ * updateopenslots(). Then do the same for the implementations of
+ * expectkeeps(), the packing of positions, and the dice.
+ */
+int main(void)
+{
+    unsigned char (*hands)[ctl_dice_count];
+    unsigned char (*scores)[ctl_slots_count];
+    unsigned char (*expected)[ctl_slots_count];
+    double handvalues[hand_count];
+    double keepvalues[keep_count], expectedkeepvalues[keep_count];
+    double t;
+    int method, n, i;
+
+    hands = allocate(bench_handcount * sizeof *hands);
+    scores = allocate(bench_handcount * sizeof *scores);
+    expected = allocate(bench_handcount * sizeof *expected);
+    srand(1);
+    for (n = 0 ; n < bench_handcount ; ++n)
+	for (i = 0 ; i < ctl_dice_count ; ++i)
+	    hands[n][i] = rand() % 6;
+
+    initscoring();
+    t = now();
+    for (i = 0 ; i < bench_passcount ; ++i)
+	scoreviacontrols(hands, expected, bench_handcount);
+    t = now() - t;
+    printf("%-16s %12.0f hands/sec\n", "updateopenslots",
+	   bench_passcount * (double)bench_handcount / t);
+
+    for (method = 0 ; method < scoring_count ; ++method) {
+	if (!selectscoring(method)) {
+	    printf("%-16s  unavailable\n", methodnames[method]);
+	    continue;
+	}
+	memset(scores, 0xFF, bench_handcount * sizeof *scores);
+	t = now();
+	for (i = 0 ; i < bench_passcount ; ++i)
+	    scorehands(hands, scores, bench_handcount);
+	t = now() - t;
+	if (memcmp(scores, expected, bench_handcount * sizeof *scores))
+	    croak("%s: results do not match updateopenslots()",
+		  methodnames[method]);
+	printf("%-16s %12.0f hands/sec\n", methodnames[method],
+	       bench_passcount * (double)bench_handcount / t);
+    }
+
+    for (n = 0 ; n < hand_count ; ++n)
+	handvalues[n] = (rand() * 100.0) / RAND_MAX;
+    expectkeepsdirectly(handvalues, expectedkeepvalues);
+    for (method = 0 ; method < transitions_count ; ++method) {
+	if (!selecttransitions(method)) {
+	    printf("%-16s  unavailable\n", transitionnames[method]);
+	    continue;
+	}
+	memset(keepvalues, 0xFF, sizeof keepvalues);
+	t = now();
+	for (i = 0 ; i < bench_matrixcount ; ++i)
+	    expectkeeps(handvalues, keepvalues);
+	t = now() - t;
+	if (memcmp(keepvalues, expectedkeepvalues, sizeof keepvalues))
+	    croak("%s: results do not match the list of keeps",
+		  transitionnames[method]);
+	printf("%-16s %12.0f keeps/sec\n", transitionnames[method],
+	       bench_matrixcount * (double)keep_count / t);
+    }
+
+    benchpositions();
+    benchdice();
+    return 0;
+}
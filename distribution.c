@@ -0,0 +1,449 @@
+/* distribution.c: The distribution of the final score.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "hand.h"
+#include "tables.h"
+#include "transitions.h"
+#include "solver.h"
+#include "distribution.h"
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define DISTRIBUTION_SIMD
+#include <immintrin.h>
+#endif
+
+/* Probabilities smaller than this are dropped from the ends of the
+ * distributions used while solving.
+ */
+#define	negligible		1e-12
+
+/* The distribution of the remaining score from a state while the
+ * solve is running, as single-precision probabilities. Entry n of
+ * odds is the probability of scoring low + n more points.
+ */
+struct workingdist {
+    short	low;			/* the lowest possible score */
+    short	count;			/* the number of entries in odds */
+    float      *odds;			/* the probabilities */
+};
+
+/* The state shared by the threads during a solve. The working
+ * distributions are only kept until the layer before them is done.
+ */
+static struct {
+    float const *table;			/* the expected scores */
+    struct workingdist *working;	/* the unquantized distributions */
+    struct scoredistribution *states;	/* the quantized distributions */
+    unsigned short **cdfs;		/* the quantized probabilities */
+} solve;
+
+/* The probability of each hand on a roll of all five dice.
+ */
+static double handodds[hand_count];
+
+/* Pointer to the selected implementation of addscaled().
+ */
+static void (*addscaled)(double *sums, double weight,
+			 float const *odds, int count);
+
+/*
+ * The implementations of addscaled(), which adds a distribution
+ * times a weight to a running sum.
+ */
+
+/* Add each term in turn.
+ */
+static void scalar_addscaled(double *sums, double weight,
+			     float const *odds, int count)
+{
+    int n;
+
+    for (n = 0 ; n < count ; ++n)
+	sums[n] += weight * odds[n];
+}
+
+#ifdef DISTRIBUTION_SIMD
+
+/* Add the terms four at a time, widening the probabilities to double
+ * precision as they are loaded. (The upper halves of the registers
+ * are cleared before returning, since gcc does not do so when
+ * optimizing for size.)
+ */
+__attribute__((target("avx")))
+static void avx_addscaled(double *sums, double weight,
+			  float const *odds, int count)
+{
+    __m256d w;
+    int n;
+
+    w = _mm256_set1_pd(weight);
+    for (n = 0 ; n + 4 <= count ; n += 4)
+	_mm256_storeu_pd(sums + n,
+		 _mm256_add_pd(_mm256_loadu_pd(sums + n),
+			       _mm256_mul_pd(w,
+				     _mm256_cvtps_pd(_mm_loadu_ps(odds + n)))));
+    _mm256_zeroupper();
+    for ( ; n < count ; ++n)
+	sums[n] += weight * odds[n];
+}
+
+#endif
+
+/*
+ * Solving a single state.
+ */
+
+/* Find the odds of each hand, and select the implementation of
+ * addscaled().
+ */
+static void initdistribution(void)
+{
+    int h;
+
+    inittransitions();
+    for (h = 0 ; h < hand_count ; ++h)
+	handodds[h] = rollodds[keepindex(handlist[h])];
+
+    addscaled = scalar_addscaled;
+#ifdef DISTRIBUTION_SIMD
+    if (__builtin_cpu_supports("avx"))
+	addscaled = avx_addscaled;
+#endif
+}
+
+/* Given the probability of making each keep, compute the probability
+ * of each hand after rolling the dice not kept.
+ */
+static void rollkeeps(double const *keeps, double *hands)
+{
+    int k, entry, stride, n;
+
+    memset(hands, 0, hand_count * sizeof *hands);
+    for (k = 0 ; k < keep_count ; ++k) {
+	if (!keeps[k])
+	    continue;
+	for (n = transitionrow(k, &entry, &stride) ; n ; --n, entry += stride)
+	    hands[transitionhands[entry]] += keeps[k] * transitionodds[entry];
+    }
+}
+
+/* Add a successor's distribution to the running sum, convolved with
+ * the probabilities of scoring each number of points on the way to
+ * it. Points with a probability of zero are skipped.
+ */
+static void convolve(double *sums, double const *pointodds, int pointcount,
+		     struct workingdist const *dist)
+{
+    int points;
+
+    for (points = 0 ; points < pointcount ; ++points)
+	if (pointodds[points])
+	    addscaled(sums + points + dist->low, pointodds[points],
+		      dist->odds, dist->count);
+}
+
+/* Store a state's distribution, given the unnormalized probability of
+ * each final score. Negligible probabilities are trimmed from the
+ * ends of the working copy, and the ends of the quantized copy are
+ * trimmed wherever the cumulative probability rounds to zero or one.
+ */
+static void storedistribution(int state, double const *sums)
+{
+    struct workingdist *dist = &solve.working[state];
+    struct scoredistribution *stored = &solve.states[state];
+    double total, cumulative;
+    int low, high, n, q;
+
+    total = 0.0;
+    for (n = 0 ; n <= maxscore ; ++n)
+	total += sums[n];
+    for (low = 0 ; low < maxscore && sums[low] < negligible * total ; ++low) ;
+    for (high = maxscore ; high > low && sums[high] < negligible * total ;
+	 --high) ;
+    dist->low = low;
+    dist->count = high - low + 1;
+    dist->odds = allocate(dist->count * sizeof *dist->odds);
+    for (n = low ; n <= high ; ++n)
+	dist->odds[n - low] = sums[n] / total;
+
+    stored->low = low;
+    stored->count = 0;
+    solve.cdfs[state] = allocate((high - low + 1) * sizeof **solve.cdfs);
+    cumulative = 0.0;
+    for (n = low ; n <= high ; ++n) {
+	cumulative += sums[n];
+	q = (int)(65535.0 * cumulative / total + 0.5);
+	if (q >= 65535)
+	    break;
+	if (q == 0)
+	    stored->low = n + 1;
+	else
+	    solve.cdfs[state][stored->count++] = q;
+    }
+}
+
+/* Compute the distribution of the remaining score from a state.
+ * Following the optimal choices forwards through the turn gives the
+ * probability of scoring each number of points in each category,
+ * and the distribution is then the sum of the following states'
+ * distributions, convolved with those probabilities.
+ */
+static void distributestate(int mask, int subtotal)
+{
+    struct turnpolicy policy;
+    double hands[hand_count], keeps[keep_count];
+    double pointodds[category_count][50 + 1];
+    double sums[maxscore + 1];
+    int rerolls, h, c, n, score, next;
+
+    findturnpolicy(solve.table, mask, subtotal, &policy);
+    memcpy(hands, handodds, sizeof hands);
+    for (rerolls = 1 ; rerolls >= 0 ; --rerolls) {
+	memset(keeps, 0, sizeof keeps);
+	for (h = 0 ; h < hand_count ; ++h)
+	    keeps[policy.keeps[rerolls][h]] += hands[h];
+	rollkeeps(keeps, hands);
+    }
+
+    /* For the upper categories, pointodds is indexed by the number of
+     * dice showing the category's face, as the points scored there
+     * also change the subtotal. For the lower categories, it is
+     * indexed by the points scored.
+     */
+    memset(pointodds, 0, sizeof pointodds);
+    for (h = 0 ; h < hand_count ; ++h) {
+	c = policy.categories[h];
+	if (c < 6)
+	    pointodds[c][handcount(handlist[h], c)] += hands[h];
+	else
+	    pointodds[c][handscores[h][categoryslots[c] - ctl_slots]]
+		+= hands[h];
+    }
+
+    memset(sums, 0, sizeof sums);
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	if (c >= 6) {
+	    convolve(sums, pointodds[c], 50 + 1,
+		     &solve.working[stateindex(mask | (1 << c), subtotal)]);
+	    continue;
+	}
+	for (n = 0 ; n <= ctl_dice_count ; ++n) {
+	    score = (c + 1) * n;
+	    next = subtotal + score;
+	    if (next >= 63) {
+		next = 63;
+		if (subtotal < 63)
+		    score += 35;
+	    }
+	    convolve(sums + score, &pointodds[c][n], 1,
+		     &solve.working[stateindex(mask | (1 << c), next)]);
+	}
+    }
+    storedistribution(stateindex(mask, subtotal), sums);
+}
+
+/* Compute the distributions for every state of a category mask. When
+ * every category has been used, no more points can be scored.
+ */
+static void distributemask(void *data, int mask)
+{
+    double sums[maxscore + 1];
+    int subtotal;
+
+    (void)data;
+    for (subtotal = 0 ; subtotal < subtotal_count ; ++subtotal) {
+	if (!isreachable(mask, subtotal)) {
+	    solve.working[stateindex(mask, subtotal)].count = 0;
+	    solve.states[stateindex(mask, subtotal)].count = 0;
+	    solve.cdfs[stateindex(mask, subtotal)] = NULL;
+	} else if (mask == categorymask_count - 1) {
+	    memset(sums, 0, sizeof sums);
+	    sums[0] = 1.0;
+	    storedistribution(stateindex(mask, subtotal), sums);
+	} else {
+	    distributestate(mask, subtotal);
+	}
+    }
+}
+
+/* Once a layer is done, the working distributions of the layer after
+ * it are no longer needed.
+ */
+static void finishlayer(void *data, int layer)
+{
+    int mask, subtotal;
+
+    (void)data;
+    for (mask = 0 ; mask < categorymask_count ; ++mask) {
+	if (__builtin_popcount(mask) != layer + 1)
+	    continue;
+	for (subtotal = 0 ; subtotal < subtotal_count ; ++subtotal) {
+	    if (solve.working[stateindex(mask, subtotal)].count) {
+		free(solve.working[stateindex(mask, subtotal)].odds);
+		solve.working[stateindex(mask, subtotal)].count = 0;
+	    }
+	}
+    }
+}
+
+/*
+ * Choosing moves.
+ */
+
+/* Compute the probability of scoring at least the given number of
+ * points during the rest of the game from a hand at the end of a
+ * turn, when each later turn is played for the expected score. This
+ * is the best choice of open category, which is stored in category.
+ */
+static double reachhandvalue(struct distributiontable const *table,
+			     int mask, int subtotal, int points, int h,
+			     int *category)
+{
+    double best, value;
+    int c, score, next;
+
+    best = 0.0;
+    *category = -1;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	next = subtotal;
+	if (c < 6) {
+	    score = (c + 1) * handcount(handlist[h], c);
+	    next = subtotal + score;
+	    if (next >= 63) {
+		next = 63;
+		if (subtotal < 63)
+		    score += 35;
+	    }
+	} else {
+	    score = handscores[h][categoryslots[c] - ctl_slots];
+	}
+	value = 1.0 - scorecdf(table, mask | (1 << c), next,
+			       points - score - 1);
+	if (*category < 0 || best < value) {
+	    best = value;
+	    *category = c;
+	}
+    }
+    return best;
+}
+
+/*
+ * Exported functions.
+ */
+
+/* Solve every state, and then gather the quantized distributions into
+ * one block.
+ */
+struct distributiontable *solvedistributions(float const *table,
+					      int threadcount, FILE *log)
+{
+    struct distributiontable *result;
+    struct scoredistribution *states;
+    unsigned short *cdf;
+    unsigned int count;
+    int state;
+
+    initdistribution();
+    solve.table = table;
+    solve.working = allocate(state_count * sizeof *solve.working);
+    solve.states = allocate(state_count * sizeof *solve.states);
+    solve.cdfs = allocate(state_count * sizeof *solve.cdfs);
+    solvelayers(threadcount, distributemask, finishlayer, NULL, log);
+    finishlayer(NULL, -1);
+
+    count = 0;
+    for (state = 0 ; state < state_count ; ++state) {
+	solve.states[state].offset = count;
+	count += solve.states[state].count;
+    }
+    count += count & 1;
+    result = allocate(sizeof *result + state_count * sizeof *states
+					  + count * sizeof *cdf);
+    states = (struct scoredistribution*)(result + 1);
+    cdf = (unsigned short*)(states + state_count);
+    memcpy(states, solve.states, state_count * sizeof *states);
+    cdf[count - 1] = 0;
+    for (state = 0 ; state < state_count ; ++state) {
+	memcpy(cdf + states[state].offset, solve.cdfs[state],
+	       states[state].count * sizeof *cdf);
+	free(solve.cdfs[state]);
+    }
+    free(solve.working);
+    free(solve.states);
+    free(solve.cdfs);
+
+    result->states = states;
+    result->cdf = cdf;
+    result->cdfcount = count;
+    return result;
+}
+
+/* Look up a single cumulative probability.
+ */
+double scorecdf(struct distributiontable const *table,
+		int mask, int subtotal, int points)
+{
+    struct scoredistribution const *state;
+
+    state = &table->states[stateindex(mask, subtotal)];
+    if (points < state->low)
+	return 0.0;
+    if (points >= state->low + state->count)
+	return 1.0;
+    return table->cdf[state->offset + points - state->low] / 65535.0;
+}
+
+/* Search the stored range for the first cumulative probability that
+ * reaches the fraction.
+ */
+int scorequantile(struct distributiontable const *table,
+		  int mask, int subtotal, double fraction)
+{
+    struct scoredistribution const *state;
+    int n;
+
+    state = &table->states[stateindex(mask, subtotal)];
+    for (n = 0 ; n < state->count ; ++n)
+	if (table->cdf[state->offset + n] >= fraction * 65535.0)
+	    break;
+    return state->low + n;
+}
+
+/* Compute the hand values from the successors' distributions, and
+ * let the solver pick the keep.
+ */
+int choosereachkeep(struct distributiontable const *table, int mask,
+		    int subtotal, int points, unsigned char const *dice,
+		    int rerolls)
+{
+    double hands[hand_count];
+    int h, c;
+
+    for (h = 0 ; h < hand_count ; ++h)
+	hands[h] = reachhandvalue(table, mask, subtotal, points, h, &c);
+    return choosekeepbyvalue(hands, dice, rerolls);
+}
+
+/* Pick the category that gives the dice the best chance.
+ */
+int choosereachcategory(struct distributiontable const *table, int mask,
+			int subtotal, int points, unsigned char const *dice)
+{
+    int category;
+
+    reachhandvalue(table, mask, subtotal, points, sortdice(dice, NULL),
+		   &category);
+    return category;
+}
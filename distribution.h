@@ -0,0 +1,83 @@
+/* distribution.h: The distribution of the final score.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _distribution_h_
+#define _distribution_h_
+
+/* The highest score possible in a game.
+ */
+#define	maxscore		375
+
+/* The distribution of the points still to be scored from one
+ * turn-start state, stored as cumulative probabilities quantized to
+ * 16 bits. For points from low up to low + count, the probability of
+ * scoring no more than that many points is cdf[offset + points - low]
+ * divided by 65535. Below low the probability is zero, and from low +
+ * count upwards it is one, so only the part of the distribution that
+ * cannot be told apart from zero or one is stored.
+ */
+struct scoredistribution {
+    unsigned short	low;		/* the start of the stored range */
+    unsigned short	count;		/* the length of the stored range */
+    unsigned int	offset;		/* the range's position in cdf */
+};
+
+/* A table of distributions, with one entry for every turn-start
+ * state, indexed by stateindex(). The cumulative probabilities of all
+ * the states are stored together in one array of cdfcount entries,
+ * which is always an even number.
+ */
+struct distributiontable {
+    struct scoredistribution const *states;
+    unsigned short const *cdf;
+    unsigned int cdfcount;
+};
+
+/* Compute the distribution of the remaining score from every
+ * turn-start state, when the rest of the game is played so as to
+ * maximize the expected score according to the given solution table.
+ * The return value is newly allocated as a single block, and can be
+ * freed with free(). The arguments threadcount and log are as for
+ * solvegame().
+ */
+extern struct distributiontable *solvedistributions(float const *table,
+						     int threadcount,
+						     FILE *log);
+
+/* Return the probability that no more than the given number of
+ * points are scored during the rest of the game from a turn-start
+ * state. At the start of the game, this is the fraction of games
+ * whose final score is no higher than points.
+ */
+extern double scorecdf(struct distributiontable const *table,
+		       int mask, int subtotal, int points);
+
+/* Return the smallest number of points such that the probability of
+ * scoring no more than that many during the rest of the game is at
+ * least fraction.
+ */
+extern int scorequantile(struct distributiontable const *table,
+			 int mask, int subtotal, double fraction);
+
+/* Choose which dice to keep so as to have the best chance of scoring
+ * at least points more during the rest of the game, assuming that
+ * every turn after this one is played for the expected score. This is
+ * found from the table alone, with one turn of lookahead, and so is
+ * only an approximation of what solvetargets() works out in full. The
+ * other arguments and the return value are as for choosekeep().
+ */
+extern int choosereachkeep(struct distributiontable const *table,
+			   int mask, int subtotal, int points,
+			   unsigned char const *dice, int rerolls);
+
+/* Choose which open category to score a roll in, in the same manner
+ * as choosereachkeep().
+ */
+extern int choosereachcategory(struct distributiontable const *table,
+			       int mask, int subtotal, int points,
+			       unsigned char const *dice);
+
+#endif
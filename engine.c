@@ -0,0 +1,352 @@
+/* engine.c: The game's state machine.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include "yahtzee.h"
+#include "scoring.h"
+#include "advisor.h"
+#include "rng.h"
+#include "engine.h"
+
+/* Macros for changing the control flags.
+ */
+#define setselected(control)	((control).flags |= ctlflag_selected)
+#define clearselected(control)	((control).flags &= ~ctlflag_selected)
+#define flipselected(control)	((control).flags ^= ctlflag_selected)
+#define setdisabled(control)	((control).flags |= ctlflag_disabled)
+#define cleardisabled(control)	((control).flags &= ~ctlflag_disabled)
+#define setmodified(control)	((control).flags |= ctlflag_modified)
+
+/*
+ * I/O control management.
+ */
+
+/* Unmark and roll all of the dice.
+ */
+static void rollalldice(struct game *game)
+{
+    unsigned char dice[ctl_dice_count];
+    int i;
+
+    rngdice(game->rng, dice, ctl_dice_count);
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+	cleardisabled(game->controls[i]);
+	clearselected(game->controls[i]);
+	game->controls[i].value = dice[i - ctl_dice];
+	setmodified(game->controls[i]);
+    }
+    updateopenslots(game);
+}
+
+/* Reroll the dice that are currently selected.
+ */
+static void rolldice(struct game *game)
+{
+    int i;
+
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+	if (isselected(game->controls[i])) {
+	    clearselected(game->controls[i]);
+	    game->controls[i].value = rngdie(game->rng);
+	    setmodified(game->controls[i]);
+	}
+    }
+    updateopenslots(game);
+}
+
+/* Mark the dice as fixed.
+ */
+static void freezedice(struct game *game)
+{
+    int i;
+
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i)
+	setdisabled(game->controls[i]);
+}
+
+/* Erase the scores in all of the slots.
+ */
+static void clearallslots(struct game *game)
+{
+    int i;
+
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
+	game->controls[i].value = -1;
+	clearselected(game->controls[i]);
+	if (game->controls[i].key)
+	    cleardisabled(game->controls[i]);
+	else
+	    setdisabled(game->controls[i]);
+    }
+    resetscores(game);
+}
+
+
+/*
+ * The state machine.
+ */
+
+/* Count the open slots, and find the selected slot, if there is one.
+ */
+static int findslots(struct game *game, struct control **selectedslot)
+{
+    int slotopencount, i;
+
+    *selectedslot = 0;
+    slotopencount = 0;
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
+	if (!isdisabled(game->controls[i]))
+	    ++slotopencount;
+	if (isselected(game->controls[i]))
+	    *selectedslot = &game->controls[i];
+    }
+    return slotopencount;
+}
+
+/* Find the input for a move that the player has no choice about,
+ * which is the last slot of the game once the dice have been rolled
+ * for the third time: the slot is selected and then scored. Returns
+ * false if the player has a choice.
+ */
+static int forcedinput(struct game *game, int *ctl)
+{
+    struct control *selectedslot;
+    int i;
+
+    if (game->rollcount != 3 || findslots(game, &selectedslot) != 1)
+	return 0;
+    *ctl = ctl_button;
+    if (!selectedslot)
+	for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	    if (!isdisabled(game->controls[i]))
+		*ctl = i;
+    return 1;
+}
+
+/* Apply the user's action to the game state. A request for a hint is
+ * applied by selecting the dice to reroll or the slot to score, just
+ * as if the user had selected them. Returns false if the action is
+ * not allowed in the current state.
+ */
+static int applyinput(struct game *game, int ctl)
+{
+    struct control *control;
+    struct control *selectedslot;
+    int slotopencount, rerolls, i;
+
+    slotopencount = findslots(game, &selectedslot);
+    if (ctl == ctl_hint) {
+	ctl = getadvice(game, &rerolls);
+	if (ctl < 0)
+	    return 0;
+	if (ctl == ctl_button) {
+	    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+		if (rerolls & (1 << (i - ctl_dice)))
+		    setselected(game->controls[i]);
+		else
+		    clearselected(game->controls[i]);
+		setmodified(game->controls[i]);
+	    }
+	    if (selectedslot) {
+		clearselected(*selectedslot);
+		setmodified(*selectedslot);
+		markslotunselected(game, selectedslot - game->controls);
+		updatescores(game);
+	    }
+	    return 1;
+	}
+	if (&game->controls[ctl] == selectedslot)
+	    return 1;
+    }
+    control = &game->controls[ctl];
+    if (isdisabled(*control))
+	return 0;
+
+    if (ctl >= ctl_dice && ctl < ctl_dice_end) {
+	if (game->rollcount == 3)
+	    return 0;
+	flipselected(*control);
+	if (selectedslot) {
+	    clearselected(*selectedslot);
+	    setmodified(*selectedslot);
+	    markslotunselected(game, selectedslot - game->controls);
+	    updatescores(game);
+	}
+	return 1;
+    }
+    if (ctl >= ctl_slots && ctl < ctl_slots_end) {
+	setselected(*control);
+	setmodified(*control);
+	markslotselected(game, ctl);
+	if (selectedslot) {
+	    clearselected(*selectedslot);
+	    setmodified(*selectedslot);
+	    markslotunselected(game, selectedslot - game->controls);
+	}
+	for (i = ctl_dice ; i < ctl_dice_end ; ++i)
+	    clearselected(game->controls[i]);
+	updatescores(game);
+	return 1;
+    }
+    if (ctl == ctl_button) {
+	if (control->value == bval_score) {
+	    if (!selectedslot)
+		return 0;
+	    setdisabled(*selectedslot);
+	    clearselected(*selectedslot);
+	    setmodified(*selectedslot);
+	    markslotused(game, selectedslot - game->controls);
+	    if (slotopencount > 1) {
+		rollalldice(game);
+		game->rollcount = 1;
+	    }
+	} else {
+	    if (game->rollcount == 3)
+		return 0;
+	    rolldice(game);
+	    ++game->rollcount;
+	}
+	return 1;
+    }
+    return 0;
+}
+
+/* Bring the controls up to date after the game state has changed,
+ * and make any moves that the player has no choice about.
+ */
+static void settle(struct game *game)
+{
+    int ctl;
+
+    updatecontrols(game);
+    while (forcedinput(game, &ctl)) {
+	applyinput(game, ctl);
+	updatecontrols(game);
+    }
+}
+
+/*
+ * Exported functions.
+ */
+
+/* The button's label and whether it can be pushed, and whether the
+ * dice can still be rerolled, follow from the slots and the roll
+ * count. Once every slot has been used, the final scores are filled
+ * in and the button offers another game.
+ */
+void updatecontrols(struct game *game)
+{
+    struct control *selectedslot;
+    int i;
+
+    if (findslots(game, &selectedslot) == 0) {
+	updatescores(game);
+	game->controls[ctl_button].value = bval_newgame;
+	cleardisabled(game->controls[ctl_button]);
+	return;
+    }
+    if (game->rollcount == 3 || selectedslot) {
+	game->controls[ctl_button].value = bval_score;
+	if (selectedslot)
+	    cleardisabled(game->controls[ctl_button]);
+	else
+	    setdisabled(game->controls[ctl_button]);
+	if (game->rollcount == 3)
+	    freezedice(game);
+    } else {
+	game->controls[ctl_button].value = bval_roll;
+	setdisabled(game->controls[ctl_button]);
+	for (i = ctl_dice ; i < ctl_dice_end ; ++i)
+	    if (isselected(game->controls[i]))
+		cleardisabled(game->controls[ctl_button]);
+    }
+}
+
+/* Set the hotkeys that the user interfaces show.
+ */
+void initcontrols(struct game *game)
+{
+    int i;
+
+    for (i = 0 ; i < ctl_count ; ++i) {
+	game->controls[i].value = -1;
+	cleardisabled(game->controls[i]);
+	clearselected(game->controls[i]);
+	clearmodified(game->controls[i]);
+    }
+
+    game->controls[ctl_die_0].key = 'a';
+    game->controls[ctl_die_1].key = 'b';
+    game->controls[ctl_die_2].key = 'c';
+    game->controls[ctl_die_3].key = 'd';
+    game->controls[ctl_die_4].key = 'e';
+    game->controls[ctl_button].key = ' ';
+    game->controls[ctl_slot_ones].key = '1';
+    game->controls[ctl_slot_twos].key = '2';
+    game->controls[ctl_slot_threes].key = '3';
+    game->controls[ctl_slot_fours].key = '4';
+    game->controls[ctl_slot_fives].key = '5';
+    game->controls[ctl_slot_sixes].key = '6';
+    game->controls[ctl_slot_threeofakind].key = 't';
+    game->controls[ctl_slot_fourofakind].key = 'f';
+    game->controls[ctl_slot_fullhouse].key = 'h';
+    game->controls[ctl_slot_smallstraight].key = 's';
+    game->controls[ctl_slot_largestraight].key = 'l';
+    game->controls[ctl_slot_yahtzee].key = 'y';
+    game->controls[ctl_slot_chance].key = 'x';
+    game->rollcount = 0;
+    resetscores(game);
+}
+
+/* Clear the score sheet and take the first roll.
+ */
+void startgame(struct game *game)
+{
+    clearallslots(game);
+    rollalldice(game);
+    game->rollcount = 1;
+    settle(game);
+}
+
+/* Between games, only the button does anything.
+ */
+int step(struct game *game, int ctl)
+{
+    if (ctl < 0 || ctl > ctl_hint)
+	return 0;
+    if (isgameover(game)) {
+	if (ctl != ctl_button)
+	    return 0;
+	startgame(game);
+	return 1;
+    }
+    if (!applyinput(game, ctl))
+	return 0;
+    settle(game);
+    return 1;
+}
+
+/* Every control that is not disabled does something when it is
+ * used, and so does a request for a hint while the game is running.
+ */
+int legalinputs(struct game const *game)
+{
+    int inputs, i;
+
+    if (isgameover(game))
+	return 1 << ctl_button;
+    inputs = 1 << ctl_hint;
+    for (i = 0 ; i < ctl_count ; ++i)
+	if (!isdisabled(game->controls[i]))
+	    inputs |= 1 << i;
+    return inputs;
+}
+
+/* The button is only labeled for a new game once the game is over.
+ */
+int isgameover(struct game const *game)
+{
+    return game->controls[ctl_button].value == bval_newgame;
+}
@@ -0,0 +1,44 @@
+/* engine.h: The game's state machine.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _engine_h_
+#define _engine_h_
+
+/* Put the controls in their initial states and set their hotkeys,
+ * and clear the rest of the game's state apart from its dice. The
+ * game's source of dice must be set before the first game starts.
+ */
+extern void initcontrols(struct game *game);
+
+/* Start a new game, rolling the dice for the first turn.
+ */
+extern void startgame(struct game *game);
+
+/* Set the button and the dice to match the rest of the game's state,
+ * which is the roll count and which slots are used and selected.
+ */
+extern void updatecontrols(struct game *game);
+
+/* Apply one input event to a game, which is either a control ID or
+ * ctl_hint. When the event leaves the player with no choice, the
+ * moves that follow are made as well, so on return the game is
+ * always waiting for input. Once the game is over, pushing the button
+ * starts another one. Returns false if the event was ignored, in
+ * which case the game is unchanged.
+ */
+extern int step(struct game *game, int ctl);
+
+/* Return a bitmask of the input events that the game will currently
+ * accept, with bit n set for control ID n (or for ctl_hint).
+ */
+extern int legalinputs(struct game const *game);
+
+/* True if every slot has been used, and the game is waiting for the
+ * button to start another.
+ */
+extern int isgameover(struct game const *game);
+
+#endif
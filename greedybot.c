@@ -0,0 +1,124 @@
+/* greedybot.c: A plugin that plays the greedy policy.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <string.h>
+#include "yahtzeebot.h"
+
+/* This is the same policy as the built-in greedy policy, and makes
+ * the same choices, but as a plugin it can only see the packed
+ * states, so it does its own scoring. Build it with "make
+ * greedybot.so" and use it with "--policy ./greedybot.so".
+ */
+
+/* Count the dice showing each face.
+ */
+static void countfaces(unsigned long long state, int *counts)
+{
+    int i;
+
+    memset(counts, 0, 6 * sizeof *counts);
+    for (i = 0 ; i < yb_dice_count ; ++i)
+	++counts[yb_die(state, i)];
+}
+
+/* Return the score of the dice in a category. As in the game, five of
+ * a kind also counts as a full house.
+ */
+static int score(int const *counts, int category)
+{
+    int sum, most, run, longest, face;
+
+    if (category < 6)
+	return (category + 1) * counts[category];
+    sum = most = run = longest = 0;
+    for (face = 0 ; face < 6 ; ++face) {
+	sum += (face + 1) * counts[face];
+	if (most < counts[face])
+	    most = counts[face];
+	run = counts[face] ? run + 1 : 0;
+	if (longest < run)
+	    longest = run;
+    }
+    switch (category) {
+      case 6:	return most >= 3 ? sum : 0;
+      case 7:	return most >= 4 ? sum : 0;
+      case 8:
+	if (most == 5)
+	    return 25;
+	for (face = 0 ; face < 6 ; ++face)
+	    if (counts[face] == 1)
+		return 0;
+	return most == 3 ? 25 : 0;
+      case 9:	return longest >= 4 ? 30 : 0;
+      case 10:	return longest == 5 ? 40 : 0;
+      case 11:	return most == 5 ? 50 : 0;
+      case 12:	return sum;
+    }
+    return 0;
+}
+
+/* Keep the dice showing the most common face, preferring higher
+ * faces when there is a tie.
+ */
+static void choosekeeps(void *player, unsigned long long const *states,
+			int *keepmasks, int count)
+{
+    int counts[6];
+    int best, face, n, i;
+
+    (void)player;
+    for (n = 0 ; n < count ; ++n) {
+	countfaces(states[n], counts);
+	best = 5;
+	for (face = 4 ; face >= 0 ; --face)
+	    if (counts[face] > counts[best])
+		best = face;
+	keepmasks[n] = 0;
+	for (i = 0 ; i < yb_dice_count ; ++i)
+	    if (yb_die(states[n], i) == best)
+		keepmasks[n] |= 1 << i;
+    }
+}
+
+/* Score the dice in whichever open category gives the most points.
+ */
+static void choosecategories(void *player, unsigned long long const *states,
+			     int *categories, int count)
+{
+    int counts[6];
+    int best, bestscore, points, mask, c, n;
+
+    (void)player;
+    for (n = 0 ; n < count ; ++n) {
+	countfaces(states[n], counts);
+	mask = yb_mask(states[n]);
+	best = -1;
+	bestscore = 0;
+	for (c = 0 ; c < yb_category_count ; ++c) {
+	    if (mask & (1 << c))
+		continue;
+	    points = score(counts, c);
+	    if (best < 0 || points > bestscore) {
+		best = c;
+		bestscore = points;
+	    }
+	}
+	categories[n] = best;
+    }
+}
+
+/* The plugin's entry point.
+ */
+struct yahtzeebot const *yahtzeebot(void)
+{
+    static struct yahtzeebot const bot = {
+	yahtzeebot_version, "greedybot",
+	"take the most points available each turn (as a plugin)",
+	NULL, NULL, choosekeeps, choosecategories
+    };
+
+    return &bot;
+}
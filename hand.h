@@ -0,0 +1,68 @@
+/* hand.h: The packed representation of a hand of dice.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _hand_h_
+#define _hand_h_
+
+/* A hand is a histogram of die values packed into a single word.
+ * Each face (0 through 5) gets three bits, holding the number of
+ * dice currently showing that face, so a hand of five dice fits in
+ * 18 bits. Two hands are the same if and only if their histograms
+ * are equal, regardless of the order of the dice, so hands can be
+ * copied, compared, and hashed as plain integers.
+ */
+typedef unsigned int hand;
+
+/* Masks selecting the low, middle, and high bit of every face's
+ * count.
+ */
+#define	hand_bit0		0x09249U
+#define	hand_bit1		0x12492U
+#define	hand_bit2		0x24924U
+
+/* The hand containing a single die showing the given face. Hands
+ * with disjoint dice can be combined with simple addition.
+ */
+#define	handdie(face)		(1U << (3 * (face)))
+
+/* The number of dice in a hand that show the given face.
+ */
+#define	handcount(h, face)	(((h) >> (3 * (face))) & 7)
+
+/* Macros for adding and removing a single die.
+ */
+#define	handadddie(h, face)	((h) += handdie(face))
+#define	handremovedie(h, face)	((h) -= handdie(face))
+
+/* The following predicates test every face's count in parallel. Each
+ * returns a mask with the high bit of a face's count set if that
+ * face satisfies the condition, so the result is nonzero if any face
+ * satisfies it. Since a count is never more than five, the only
+ * values with the high bit set are 4 and 5, and 5 is the only value
+ * with both the high and low bits set.
+ */
+#define	handfaces(h)		(((h) | (h) << 1 | (h) << 2) & hand_bit2)
+#define	handpairs(h)		((h) << 1 & ~((h) | (h) << 2) & hand_bit2)
+#define	handtriples(h)		((h) << 1 & (h) << 2 & ~(h) & hand_bit2)
+#define	handthreeormore(h)	(((h) | ((h) << 1 & (h) << 2)) & hand_bit2)
+#define	handfourormore(h)	((h) & hand_bit2)
+#define	handfives(h)		((h) & (h) << 2 & hand_bit2)
+
+/* Branch-free tests for straights. The bit for each face present is
+ * shifted down onto its lower neighbors, leaving a bit set only
+ * where a run of the given length begins.
+ */
+#define	handfourinarow(h)	(handfaces(h) & handfaces(h) >> 3 & \
+				 handfaces(h) >> 6 & handfaces(h) >> 9)
+#define	handfiveinarow(h)	(handfourinarow(h) & handfaces(h) >> 12)
+
+/* The total of all the dice in a hand.
+ */
+#define	handtotal(h)		(1 * handcount(h, 0) + 2 * handcount(h, 1) + \
+				 3 * handcount(h, 2) + 4 * handcount(h, 3) + \
+				 5 * handcount(h, 4) + 6 * handcount(h, 5))
+
+#endif
@@ -4,6 +4,7 @@
  * This program is free software. See README for details.
  */
 
+#include "yahtzee.h"
 #include "iotext.h"
 #include "iocurses.h"
 #include "iosdl.h"
@@ -15,21 +16,21 @@ int (*runio)(int *control);
 
 /* Select the I/O platform to use and allow it to initialize.
  */
-int initializeio(int iomode)
+int initializeio(int iomode, struct game *game)
 {
     switch (iomode) {
       case io_text:
 	runio = text_runio;
-	return text_initializeio();
+	return text_initializeio(game);
 #ifdef INCLUDE_CURSES
       case io_curses:
 	runio = curses_runio;
-	return curses_initializeio();
+	return curses_initializeio(game);
 #endif
 #ifdef INCLUDE_SDL
       case io_sdl:
 	runio = sdl_runio;
-	return sdl_initializeio();
+	return sdl_initializeio(game);
 #endif
     }
     return 0;
@@ -11,11 +11,12 @@
  */
 enum { io_text, io_curses, io_sdl };
 
-/* Prepare the I/O subsystem. Returns false if a error occurred.
+/* Prepare the I/O subsystem to display the given game, which it
+ * keeps a pointer to. Returns false if a error occurred.
  */
-extern int initializeio(int);
+extern int initializeio(int iomode, struct game *game);
 
-/* Update the output to reflect the current game state and wait for an
+/* Update the output to reflect the game's current state and wait for an
  * input event. Returns false if the user requested that the program
  * exit. Otherwise returns true, and with control set to the control
  * id that received the input.
@@ -28,6 +28,10 @@ static int const cxButton = 13;
 static int const cxSlot = 20, cySlots = 8, cxSlotSpacing = 7;
 static int const cxSlots = 20 * 2 + 7;
 
+/* The game being displayed.
+ */
+static struct game *game;
+
 /* The layouts for the ASCII-art die faces.
  */
 static char const *diepatterns[] = {
@@ -151,23 +155,23 @@ static void render(void)
 
     x = xDice;
     for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
-	if (isselected(controls[i]))
+	if (isselected(game->controls[i]))
 	    aset(a_marked);
-	drawacsdie(yDice, x, controls[i].value);
-	if (isselected(controls[i]))
+	drawacsdie(yDice, x, game->controls[i].value);
+	if (isselected(game->controls[i]))
 	    aset(a_normal);
 	x += cxDie + cxDieSpacing;
     }
 
     /* The button. */
 
-    text = buttontext[controls[ctl_button].value];
+    text = buttontext[game->controls[ctl_button].value];
     move(yButton, xButton);
-    if (isdisabled(controls[ctl_button])) {
+    if (isdisabled(game->controls[ctl_button])) {
 	aset(a_dim);
 	printw("| %s |", text);
 	aset(a_normal);
-    } else if (isselected(controls[ctl_button])) {
+    } else if (isselected(game->controls[ctl_button])) {
 	addstr("[[");
 	aset(a_selected);
 	addstr(text);
@@ -184,12 +188,13 @@ static void render(void)
     while (i < ctl_slots_end) {
 	for (n = 0 ; n < ctl_slots_count / 2 ; ++n, ++i) {
 	    move(ySlots + n, x);
-	    if (isselected(controls[i]))
+	    if (isselected(game->controls[i]))
 		aset(a_selected);
 	    printw("%-*s", cxSlot - 3, slottext[i - ctl_slots]);
-	    if (controls[i].value >= 0) {
-		if (isdisabled(controls[i]) || isselected(controls[i]))
-		    printw("%3d", controls[i].value);
+	    if (game->controls[i].value >= 0) {
+		if (isdisabled(game->controls[i])
+				|| isselected(game->controls[i]))
+		    printw("%3d", game->controls[i].value);
 	    }
 	    aset(a_normal);
 	}
@@ -260,7 +265,8 @@ static int runhelp(void)
     mvaddstr(yDice, xDice - 1, "Use these letter keys to select the dice:");
     x = xDice + cxDie;
     for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
-	mvprintw(yDice + cyDie - 2, x - 3, "(%c)", toupper(controls[i].key));
+	mvprintw(yDice + cyDie - 2, x - 3, "(%c)",
+		 toupper(game->controls[i].key));
 	x += cxDie + cxDieSpacing;
     }
     mvaddstr(yButton - 1, xDice - 1, "Use (space) or (return)");
@@ -271,8 +277,9 @@ static int runhelp(void)
     x = xSlots;
     while (i < ctl_slots_end) {
 	for (n = 0 ; n < ctl_slots_count / 2 ; ++n, ++i)
-	    if (controls[i].key)
-		mvprintw(ySlots + n, x - 4, "(%c)", toupper(controls[i].key));
+	    if (game->controls[i].key)
+		mvprintw(ySlots + n, x - 4, "(%c)",
+			 toupper(game->controls[i].key));
 	x += cxSlot + cxSlotSpacing;
     }
     y = ySlots + cySlots;
@@ -281,6 +288,7 @@ static int runhelp(void)
     mvaddstr(y + 2, xDice - 1, "Use (ctrl R) to view the rules.");
     mvaddstr(y + 3, xDice - 1,
 	     "Use (ctrl V) to see version and license information.");
+    mvaddstr(y + 4, xDice - 1, "Use (!) to see the optimal move.");
     mvaddstr(y + 5, xDice + cxDice - 33, "Use (ctrl X) to exit the program.");
     aset(a_normal);
     move(cyScreen - 1, 0);
@@ -348,8 +356,9 @@ static int getmouseevent(int *control)
 
 /* Initialize the curses subsystem and register a palette of colors.
  */
-int curses_initializeio(void)
+int curses_initializeio(struct game *thegame)
 {
+    game = thegame;
     if (!initscr())
 	return 0;
     atexit(shutdown);
@@ -399,6 +408,9 @@ int curses_runio(int *control)
 	    if (getmouseevent(control))
 		return 1;
 	    break;
+	  case '!':
+	    *control = ctl_hint;
+	    return 1;
 	  case '?':
 	  case KEY_F(1):
 	    if (!runhelp())
@@ -426,14 +438,14 @@ int curses_runio(int *control)
 	    return 0;
 	  case 'q':
 	  case '\033':
-	    if (controls[ctl_button].value == bval_newgame)
+	    if (game->controls[ctl_button].value == bval_newgame)
 		return 0;
 	    break;
 	  case ERR:
 	    exit(1);
 	  default:
 	    for (i = 0 ; i < ctl_count ; ++i) {
-		if (controls[i].key == ch) {
+		if (game->controls[i].key == ch) {
 		    *control = i;
 		    return 1;
 		}
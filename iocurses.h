@@ -11,7 +11,7 @@
 
 /* The curses-based versions of the functions defined in io.h.
  */
-extern int curses_initializeio(void);
+extern int curses_initializeio(struct game *game);
 extern int curses_runio(int *control);
 
 #endif
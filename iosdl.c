@@ -38,7 +38,11 @@ static int cxWindow, cyWindow;
  */
 static int redrawall;
 
-/* The array of SDL control info, mirroring the controls array.
+/* The game being displayed.
+ */
+static struct game *game;
+
+/* The array of SDL control info, mirroring the game's controls.
  */
 static struct sdlcontrol sdlcontrols[ctl_count];
 
@@ -63,7 +67,7 @@ static void initcontrols(void)
     int i;
 
     for (i = 0 ; i < ctl_count ; ++i)
-	sdlcontrols[i].control = &controls[i];
+	sdlcontrols[i].control = &game->controls[i];
 
     for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
 	makedie(&sdlcontrols[i], bkgnd);
@@ -172,8 +176,9 @@ static void shutdown(void)
 
 /* Create the SDL display and initialize everything.
  */
-int sdl_initializeio(void)
+int sdl_initializeio(struct game *thegame)
 {
+    game = thegame;
     if (SDL_Init(SDL_INIT_VIDEO))
 	return 0;
     atexit(shutdown);
@@ -350,6 +355,9 @@ int sdl_runio(int *control)
 		    return 0;
 		redrawall = 1;
 		break;
+	    } else if (event.key.keysym.unicode == '!') {
+		queueinputevent(ctl_hint);
+		break;
 	    } else if (event.key.keysym.unicode == '\013') {
 		if (!showkeyhelp(sdlcontrols))
 		    return 0;
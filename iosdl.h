@@ -11,7 +11,7 @@
 
 /* The SDL-based versions of the functions defined in io.h.
  */
-extern int sdl_initializeio(void);
+extern int sdl_initializeio(struct game *game);
 extern int sdl_runio(int *control);
 
 #endif
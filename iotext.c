@@ -23,6 +23,10 @@ static char const *slotnames[ctl_slots_count] = {
     "Chance          ", "Total Score     "
 };
 
+/* The game being displayed.
+ */
+static struct game *game;
+
 /* The program keeps a snapshot of the last seen values
  * of the controls so it knows what to display.
  */
@@ -71,15 +75,21 @@ static int unqueueinputevent(int *control)
  * Display routines.
  */
 
-/* Display the dice on a single line.
+/* Display the dice on a single line. Dice that are selected for
+ * rerolling are shown in square brackets.
  */
 static void showdice(void)
 {
     int i;
 
-    printf("(%c)", '1' + controls[ctl_dice].value);
-    for (i = ctl_dice + 1 ; i < ctl_dice_end ; ++i)
-	printf("  (%c)", '1' + controls[i].value);
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+	if (i > ctl_dice)
+	    printf("  ");
+	if (isselected(game->controls[i]))
+	    printf("[%c]", '1' + game->controls[i].value);
+	else
+	    printf("(%c)", '1' + game->controls[i].value);
+    }
     printf("\n");
     displaydice = 0;
 }
@@ -93,23 +103,23 @@ static void showscoresheet(void)
     m = ctl_slots_count / 2;
     for (n = 0 ; n < m ; ++n) {
 	i = ctl_slots + n;
-	if (controls[i].key)
-	    printf("%c: %s", controls[i].key, slotnames[n]);
+	if (game->controls[i].key)
+	    printf("%c: %s", game->controls[i].key, slotnames[n]);
 	else
 	    printf("   %s", slotnames[n]);
-	if (controls[i].value >= 0 &&
-			(isdisabled(controls[i]) || isselected(controls[i])))
-	    printf("%4d  .  ", controls[i].value);
+	if (game->controls[i].value >= 0 && (isdisabled(game->controls[i])
+					     || isselected(game->controls[i])))
+	    printf("%4d  .  ", game->controls[i].value);
 	else
 	    printf("      .  ");
 	i += m;
-	if (controls[i].key)
-	    printf("%c: %s", controls[i].key, slotnames[m + n]);
+	if (game->controls[i].key)
+	    printf("%c: %s", game->controls[i].key, slotnames[m + n]);
 	else
 	    printf("   %s", slotnames[m + n]);
-	if (controls[i].value >= 0 &&
-			(isdisabled(controls[i]) || isselected(controls[i])))
-	    printf("%4d", controls[i].value);
+	if (game->controls[i].value >= 0 && (isdisabled(game->controls[i])
+					     || isselected(game->controls[i])))
+	    printf("%4d", game->controls[i].value);
 	putchar('\n');
     }
     displayscore = 0;
@@ -122,13 +132,13 @@ static void showprompt(void)
     int i;
 
     for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
-	if (ismodified(controls[i])) {
-	    clearmodified(controls[i]);
+	if (ismodified(game->controls[i])) {
+	    clearmodified(game->controls[i]);
 	    displaydice = 1;
 	}
     }
 
-    if (controls[ctl_button].value == bval_newgame) {
+    if (game->controls[ctl_button].value == bval_newgame) {
 	if (displaydice)
 	    showdice();
 	if (displayscore)
@@ -141,18 +151,22 @@ static void showprompt(void)
 	showscoresheet();
     if (displaydice)
 	showdice();
-    if (controls[ctl_button].value == bval_score &&
-			!isdisabled(controls[ctl_button])) {
+    if (game->controls[ctl_button].value == bval_score &&
+			!isdisabled(game->controls[ctl_button])) {
 	printf("Confirm (RET):\n");
 	return;
     }
 
-    if (controls[ctl_button].value == bval_roll)
-	printf("Roll (abcde) or ");
+    if (game->controls[ctl_button].value == bval_roll) {
+	if (isdisabled(game->controls[ctl_button]))
+	    printf("Roll (abcde) or ");
+	else
+	    printf("Roll (RET or abcde) or ");
+    }
     printf("Score (");
     for (i = ctl_slots ; i < ctl_slots_end ; ++i)
-	if (!isdisabled(controls[i]))
-	    putchar(controls[i].key);
+	if (!isdisabled(game->controls[i]))
+	    putchar(game->controls[i].key);
     printf("):\n");
 }
 
@@ -173,8 +187,9 @@ static void showhelp(void)
     }
     printf("\n%s",
 	   "At any time you can type (q) to exit the program, (.) to\n"
-	   "re-display the game state, (v) to see the version and license\n"
-	   "information, or (?) to view this help text again.\n");
+	   "re-display the game state, (!) to see the optimal move, (v) to\n"
+	   "see the version and license information, or (?) to view this\n"
+	   "help text again.\n");
 }
 
 /* Display version and license information.
@@ -205,22 +220,22 @@ static int processinput(char const *str, int length)
     int i, n;
 
     if (length == 0) {
-	if (isdisabled(controls[ctl_button])) {
+	if (isdisabled(game->controls[ctl_button])) {
 	    printf("Enter (?) for help.\n");
 	    return 0;
 	}
 	queueinputevent(ctl_button);
 	return 1;
     }
-    if (controls[ctl_button].value == bval_newgame)
+    if (game->controls[ctl_button].value == bval_newgame)
 	return 0;
 
     n = 0;
     memset(dice, 0, sizeof dice);
     for (p = str ; *p ; ++p) {
 	for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
-	    if (controls[i].key == tolower(*p)) {
-		if (isdisabled(controls[i])) {
+	    if (game->controls[i].key == tolower(*p)) {
+		if (isdisabled(game->controls[i])) {
 		    printf("Cannot roll dice.\n");
 		    return 0;
 		}
@@ -233,7 +248,7 @@ static int processinput(char const *str, int length)
     if (n) {
 	if (n == length) {
 	    for (i = 0 ; i < ctl_dice_count ; ++i)
-		if (dice[i])
+		if (dice[i] != !!isselected(game->controls[ctl_dice + i]))
 		    queueinputevent(ctl_dice + i);
 	    queueinputevent(ctl_button);
 	    return 1;
@@ -244,8 +259,8 @@ static int processinput(char const *str, int length)
     }
 
     for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
-	if (controls[i].key == tolower(*str)) {
-	    if (isdisabled(controls[i])) {
+	if (game->controls[i].key == tolower(*str)) {
+	    if (isdisabled(game->controls[i])) {
 		printf("Slot not available.\n");
 		return 0;
 	    }
@@ -268,13 +283,14 @@ static int processinput(char const *str, int length)
 
 /* Initialize the internal state.
  */
-int text_initializeio(void)
+int text_initializeio(struct game *thegame)
 {
     int i;
 
+    game = thegame;
     printf("\nY a h t z e e\n\n");
     for (i = ctl_slots ; i < ctl_slots_end ; ++i)
-	lastvalues[i] = controls[i].value;
+	lastvalues[i] = game->controls[i].value;
     displayscore = 0;
     displaydice = 0;
     return 1;
@@ -292,7 +308,7 @@ int text_runio(int *control)
 	if (unqueueinputevent(control))
 	    return 1;
 	for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
-	    n = isdisabled(controls[i]) || isselected(controls[i]);
+	    n = isdisabled(game->controls[i]) || isselected(game->controls[i]);
 	    if (lastvalues[i] != n) {
 		lastvalues[i] = n;
 		displayscore = 1;
@@ -317,6 +333,10 @@ int text_runio(int *control)
 	    displaydice = 1;
 	    continue;
 	}
+	if (*buf == '!') {
+	    queueinputevent(ctl_hint);
+	    continue;
+	}
 	if (*buf == '?') {
 	    showhelp();
 	    displayscore = 0;
@@ -9,7 +9,7 @@
 
 /* The pure-text-based versions of the functions defined in io.h.
  */
-extern int text_initializeio(void);
+extern int text_initializeio(struct game *game);
 extern int text_runio(int *control);
 
 #endif
@@ -0,0 +1,235 @@
+/* loadgen.c: A load generator for the game server.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "gen.h"
+#include "rng.h"
+
+/* The most commands that a game can take: two rolls, a choice and a
+ * confirmation in each of the thirteen turns, and a confirmation to
+ * start the next game.
+ */
+#define	maxgamecommands		(13 * 4 + 1)
+
+/* A client, which plays its games over its own connection, and
+ * records how long the server took to answer each command.
+ */
+struct client {
+    pthread_t		thread;		/* the client's thread */
+    char const	       *path;		/* the server's socket */
+    int			games;		/* the number of games to play */
+    struct rng		rng;		/* the source of the client's moves */
+    int			fd;		/* the connection to the server */
+    int			buflen;		/* the bytes waiting in buf */
+    char		buf[512];	/* the answers read so far */
+    double	       *latencies;	/* the time taken by each command */
+    int			count;		/* the number of commands sent */
+    long		scoretotal;	/* the sum of the final scores */
+};
+
+/* Return the current time in seconds.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Read one line of the server's answer, without the newline.
+ */
+static void readanswer(struct client *client, char *answer, int size)
+{
+    char *end;
+    ssize_t n;
+
+    for (;;) {
+	end = memchr(client->buf, '\n', client->buflen);
+	if (end)
+	    break;
+	if (client->buflen == (int)sizeof client->buf)
+	    croak("answer too long");
+	n = recv(client->fd, client->buf + client->buflen,
+		 sizeof client->buf - client->buflen, 0);
+	if (n <= 0)
+	    croak("connection to the server lost");
+	client->buflen += n;
+    }
+    n = end - client->buf;
+    if (n >= size)
+	croak("answer too long");
+    memcpy(answer, client->buf, n);
+    answer[n] = '\0';
+    client->buflen -= n + 1;
+    memmove(client->buf, end + 1, client->buflen);
+}
+
+/* Send a command and wait for the answer, noting how long it took.
+ */
+static void sendcommand(struct client *client, char const *command,
+			char *answer, int size)
+{
+    double t;
+
+    t = now();
+    if (send(client->fd, command, strlen(command), MSG_NOSIGNAL) < 0)
+	croak("connection to the server lost");
+    readanswer(client, answer, size);
+    client->latencies[client->count++] = now() - t;
+    if (!strncmp(answer, "error", 5))
+	croak("the server refused \"%.*s\": %s",
+	      (int)strlen(command) - 1, command, answer);
+}
+
+/* Play the games, choosing each move at random: the dice are rerolled
+ * two times in three while rolls remain, and otherwise a random open
+ * slot is chosen and scored.
+ */
+static void *clientthread(void *data)
+{
+    struct client *client = data;
+    struct sockaddr_un addr;
+    char answer[128], command[32];
+    char status[8], dice[8], slot[4], open[16];
+    int played, rolls, score, mask, n, i;
+
+    client->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, client->path, sizeof addr.sun_path - 1);
+    if (client->fd < 0
+		|| connect(client->fd, (struct sockaddr*)&addr, sizeof addr))
+	croak("%s: cannot connect to the server", client->path);
+    readanswer(client, answer, sizeof answer);
+
+    played = 0;
+    for (;;) {
+	if (sscanf(answer, "ok %7s %7s %d %3s %d %15s", status, dice, &rolls,
+		   slot, &score, open) != 6)
+	    croak("unexpected answer: %s", answer);
+	if (!strcmp(status, "over")) {
+	    client->scoretotal += score;
+	    if (++played == client->games)
+		break;
+	    strcpy(command, "confirm\n");
+	} else if (*slot != '-') {
+	    strcpy(command, "confirm\n");
+	} else if (rolls < 3 && rngbelow(&client->rng, 3)) {
+	    mask = 1 + rngbelow(&client->rng, 31);
+	    n = sprintf(command, "roll ");
+	    for (i = 0 ; i < 5 ; ++i)
+		if (mask & (1 << i))
+		    command[n++] = 'a' + i;
+	    strcpy(command + n, "\n");
+	} else {
+	    sprintf(command, "choose %c\n",
+		    open[rngbelow(&client->rng, strlen(open))]);
+	}
+	sendcommand(client, command, answer, sizeof answer);
+    }
+    sendcommand(client, "quit\n", answer, sizeof answer);
+    close(client->fd);
+    return NULL;
+}
+
+/* Compare two latencies, for sorting.
+ */
+static int comparelatencies(void const *a, void const *b)
+{
+    double x = *(double const*)a, y = *(double const*)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* Run the clients at once, and then report the rate at which the
+ * server answered commands and the distribution of the time it took
+ * to answer them.
+ */
+int main(int argc, char *argv[])
+{
+    static double const fractions[] = { 0.50, 0.90, 0.99, 0.999 };
+    struct client *clients;
+    unsigned long long seed;
+    double *latencies;
+    double t;
+    long scoretotal;
+    int clientcount, games, count, i, j;
+
+    if (argc < 2 || argc % 2) {
+	fputs("Usage: loadgen SOCKET [--clients N] [--games N] [--seed N]\n",
+	      stderr);
+	return EXIT_FAILURE;
+    }
+    clientcount = 64;
+    games = 100;
+    seed = time(0);
+    for (i = 2 ; i < argc ; i += 2) {
+	if (!strcmp(argv[i], "--clients"))
+	    clientcount = atoi(argv[i + 1]);
+	else if (!strcmp(argv[i], "--games"))
+	    games = atoi(argv[i + 1]);
+	else if (!strcmp(argv[i], "--seed"))
+	    seed = strtoull(argv[i + 1], NULL, 0);
+	else
+	    croak("%s: unknown option", argv[i]);
+    }
+    if (clientcount <= 0 || games <= 0)
+	croak("the number of clients and of games must be positive");
+
+    clients = allocate(clientcount * sizeof *clients);
+    t = now();
+    for (i = 0 ; i < clientcount ; ++i) {
+	memset(&clients[i], 0, sizeof clients[i]);
+	clients[i].path = argv[1];
+	clients[i].games = games;
+	rngseed(&clients[i].rng, seed, i);
+	clients[i].latencies = allocate((games * maxgamecommands + 1)
+					* sizeof *clients[i].latencies);
+	if (pthread_create(&clients[i].thread, NULL, clientthread,
+			   &clients[i]))
+	    croak("cannot create client thread %d", i);
+    }
+    count = 0;
+    scoretotal = 0;
+    for (i = 0 ; i < clientcount ; ++i) {
+	pthread_join(clients[i].thread, NULL);
+	count += clients[i].count;
+	scoretotal += clients[i].scoretotal;
+    }
+    t = now() - t;
+
+    latencies = allocate(count * sizeof *latencies);
+    for (i = j = 0 ; i < clientcount ; ++i) {
+	memcpy(latencies + j, clients[i].latencies,
+	       clients[i].count * sizeof *latencies);
+	j += clients[i].count;
+	free(clients[i].latencies);
+    }
+    qsort(latencies, count, sizeof *latencies, comparelatencies);
+
+    printf("%d clients played %d games each in %.3f sec"
+	   " (mean score %.1f)\n", clientcount, games, t,
+	   (double)scoretotal / ((double)clientcount * games));
+    printf("Commands: %d  commands/sec: %.0f  games/sec: %.0f\n",
+	   count, count / t, clientcount * (double)games / t);
+    printf("Latency (usec):");
+    for (i = 0 ; i < (int)(sizeof fractions / sizeof *fractions) ; ++i)
+	printf("  %g%%: %.1f", 100.0 * fractions[i],
+	       1e6 * latencies[(int)(fractions[i] * (count - 1))]);
+    printf("  max: %.1f\n", 1e6 * latencies[count - 1]);
+
+    free(latencies);
+    free(clients);
+    return 0;
+}
@@ -0,0 +1,543 @@
+/* mktables.c: Generate the precomputed lookup tables.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <math.h>
+#include "yahtzee.h"
+#include "hand.h"
+#include "tables.h"
+
+/* The tables being generated. (See tables.h for descriptions.)
+ */
+static struct {
+    unsigned char handlowindices[512 + 3];
+    unsigned char handhighindices[512 + 3];
+    unsigned short keeplowindices[512];
+    unsigned short keephighindices[512];
+    hand handlist[hand_count];
+    hand keeplist[keep_count];
+    unsigned char handdice[hand_count][ctl_dice_count];
+    unsigned char handscores[hand_count][ctl_slots_count];
+    unsigned short keepindices[hand_count][1 << ctl_dice_count];
+    unsigned char keepsizes[keep_count];
+    double rollodds[keep_count];
+    unsigned short transitionrowstart[transition_blockcount + 1];
+    unsigned short transitionentrystart[transition_blockcount + 1];
+    unsigned short transitionkeeps[transition_rowcount];
+    unsigned char transitionhands[transition_entrycount];
+    double transitionodds[transition_entrycount];
+} t;
+
+/* The number of dice in each half-hand, or 6 if the value is not a
+ * valid half of a hand.
+ */
+static int halfsizes[512];
+
+/* The score-evaluation functions for each slot.
+ */
+static int (*slotevalfunctions[ctl_count])(hand);
+
+/* Display a formatted error message and exit.
+ */
+static void fail(char const *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    fputs("mktables: ", stderr);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * The individual scoring functions for each slot. Each function
+ * accepts a hand, and returns the number of points that the dice
+ * would currently earn for that slot. The functions test the hand
+ * using the predicates in hand.h, and so are free of branches.
+ */
+
+static int ones(hand h)   { return 1 * handcount(h, 0); }
+static int twos(hand h)   { return 2 * handcount(h, 1); }
+static int threes(hand h) { return 3 * handcount(h, 2); }
+static int fours(hand h)  { return 4 * handcount(h, 3); }
+static int fives(hand h)  { return 5 * handcount(h, 4); }
+static int sixes(hand h)  { return 6 * handcount(h, 5); }
+
+static int chance(hand h)
+{
+    return handtotal(h);
+}
+
+static int threeofakind(hand h)
+{
+    return !!handthreeormore(h) * handtotal(h);
+}
+
+static int fourofakind(hand h)
+{
+    return !!handfourormore(h) * handtotal(h);
+}
+
+static int yahtzee(hand h)
+{
+    return !!handfives(h) * 50;
+}
+
+static int fullhouse(hand h)
+{
+    return ((handfives(h) != 0) |
+	    ((handtriples(h) != 0) & (handpairs(h) != 0))) * 25;
+}
+
+static int smallstraight(hand h)
+{
+    return !!handfourinarow(h) * 30;
+}
+
+static int largestraight(hand h)
+{
+    return !!handfiveinarow(h) * 40;
+}
+
+/* Initialize the slotevalfunctions array.
+ */
+static void initscoring(void)
+{
+    slotevalfunctions[ctl_slot_ones] = ones;
+    slotevalfunctions[ctl_slot_twos] = twos;
+    slotevalfunctions[ctl_slot_threes] = threes;
+    slotevalfunctions[ctl_slot_fours] = fours;
+    slotevalfunctions[ctl_slot_fives] = fives;
+    slotevalfunctions[ctl_slot_sixes] = sixes;
+    slotevalfunctions[ctl_slot_threeofakind] = threeofakind;
+    slotevalfunctions[ctl_slot_fourofakind] = fourofakind;
+    slotevalfunctions[ctl_slot_fullhouse] = fullhouse;
+    slotevalfunctions[ctl_slot_smallstraight] = smallstraight;
+    slotevalfunctions[ctl_slot_largestraight] = largestraight;
+    slotevalfunctions[ctl_slot_yahtzee] = yahtzee;
+    slotevalfunctions[ctl_slot_chance] = chance;
+}
+
+/*
+ * Building the tables.
+ */
+
+/* Assign indexes to hands and to keeps. Hands are ordered first by
+ * the counts of the high faces, and then by the counts of the low
+ * faces, which makes the partial index of the low half of a hand
+ * independent of the high half. Keeps are ordered the same way,
+ * except that within each high half the low halves are also ordered
+ * by their size.
+ */
+static void buildindices(void)
+{
+    int lowseen[6] = { 0, 0, 0, 0, 0, 0 };
+    int lowsmaller[7];
+    int handindex, keepindex, low, high, i;
+
+    for (low = 0 ; low < 512 ; ++low) {
+	halfsizes[low] = (low & 7) + ((low >> 3) & 7) + (low >> 6);
+	if (halfsizes[low] > 5)
+	    halfsizes[low] = 6;
+	else
+	    t.handlowindices[low] = lowseen[halfsizes[low]]++;
+    }
+    lowsmaller[0] = 0;
+    for (i = 0 ; i < 6 ; ++i)
+	lowsmaller[i + 1] = lowsmaller[i] + lowseen[i];
+    for (low = 0 ; low < 512 ; ++low)
+	if (halfsizes[low] <= 5)
+	    t.keeplowindices[low] = lowsmaller[halfsizes[low]]
+				  + t.handlowindices[low];
+
+    handindex = 0;
+    keepindex = 0;
+    for (high = 0 ; high < 512 ; ++high) {
+	if (halfsizes[high] > 5)
+	    continue;
+	t.handhighindices[high] = handindex;
+	t.keephighindices[high] = keepindex;
+	handindex += lowseen[5 - halfsizes[high]];
+	keepindex += lowsmaller[6 - halfsizes[high]];
+    }
+    if (handindex != hand_count || keepindex != keep_count)
+	fail("found %d hands and %d keeps", handindex, keepindex);
+
+    for (high = 0 ; high < 512 ; ++high) {
+	if (halfsizes[high] > 5)
+	    continue;
+	for (low = 0 ; low < 512 ; ++low) {
+	    if (halfsizes[low] + halfsizes[high] > 5)
+		continue;
+	    i = t.keeplowindices[low] + t.keephighindices[high];
+	    t.keeplist[i] = low | high << 9;
+	    t.keepsizes[i] = halfsizes[low] + halfsizes[high];
+	    if (halfsizes[low] + halfsizes[high] == 5) {
+		i = t.handlowindices[low] + t.handhighindices[high];
+		t.handlist[i] = low | high << 9;
+	    }
+	}
+    }
+}
+
+/* Fill in the sorted dice and the slot scores for every hand.
+ */
+static void buildscores(void)
+{
+    hand h;
+    int n, face, i;
+
+    for (n = 0 ; n < hand_count ; ++n) {
+	h = t.handlist[n];
+	i = 0;
+	for (face = 0 ; face < 6 ; ++face)
+	    for ( ; handcount(h, face) ; handremovedie(h, face))
+		t.handdice[n][i++] = face;
+	h = t.handlist[n];
+	for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	    if (slotevalfunctions[i])
+		t.handscores[n][i - ctl_slots] = slotevalfunctions[i](h);
+    }
+}
+
+/* Fill in the keep index for every mask of every hand.
+ */
+static void buildkeeps(void)
+{
+    hand h;
+    int n, mask, i;
+
+    for (n = 0 ; n < hand_count ; ++n) {
+	for (mask = 0 ; mask < 1 << ctl_dice_count ; ++mask) {
+	    h = 0;
+	    for (i = 0 ; i < ctl_dice_count ; ++i)
+		if (mask & (1 << i))
+		    handadddie(h, t.handdice[n][i]);
+	    t.keepindices[n][mask] = t.keeplowindices[h & 0777]
+				   + t.keephighindices[h >> 9];
+	}
+    }
+}
+
+/* Compute the probability of rolling each keep. This is the
+ * multinomial coefficient of its dice, divided by the number of
+ * ordered rolls.
+ */
+static void buildodds(void)
+{
+    static double const factorials[6] = { 1, 1, 2, 6, 24, 120 };
+    double n;
+    int k, face;
+
+    for (k = 0 ; k < keep_count ; ++k) {
+	n = factorials[t.keepsizes[k]];
+	for (face = 0 ; face < 6 ; ++face)
+	    n /= factorials[handcount(t.keeplist[k], face)];
+	t.rollodds[k] = n / pow(6, t.keepsizes[k]);
+    }
+}
+
+/* Lay out the transition matrix. The rows of each block are the
+ * keeps of one size, in order of keep index, and the columns are the
+ * rolls of the remaining dice, in the same order.
+ */
+static void buildtransitions(void)
+{
+    hand h;
+    int rowcount, row, entry, block, size, k, r, n;
+
+    row = 0;
+    entry = 0;
+    for (block = 0 ; block < transition_blockcount ; ++block) {
+	t.transitionrowstart[block] = row;
+	t.transitionentrystart[block] = entry;
+	size = ctl_dice_count - block;
+	n = 0;
+	for (k = 0 ; k < keep_count ; ++k)
+	    if (t.keepsizes[k] == size)
+		t.transitionkeeps[row + n++] = k;
+	rowcount = (n + 3) & ~3;
+	for ( ; n < rowcount ; ++n)
+	    t.transitionkeeps[row + n] = t.transitionkeeps[row + n - 1];
+	for (r = 0 ; r < keep_count ; ++r) {
+	    if (t.keepsizes[r] != block)
+		continue;
+	    for (n = 0 ; n < rowcount ; ++n) {
+		h = t.keeplist[t.transitionkeeps[row + n]] + t.keeplist[r];
+		t.transitionhands[entry + n] = t.handlowindices[h & 0777]
+					     + t.handhighindices[h >> 9];
+		t.transitionodds[entry + n] = t.rollodds[r];
+	    }
+	    entry += rowcount;
+	}
+	row += rowcount;
+    }
+    t.transitionrowstart[block] = row;
+    t.transitionentrystart[block] = entry;
+    if (row != transition_rowcount || entry != transition_entrycount)
+	fail("found %d transition rows and %d entries", row, entry);
+}
+
+/*
+ * Checking the tables.
+ */
+
+/* Score a roll of five dice the straightforward way, by counting.
+ */
+static int checkscore(int slot, int const dice[])
+{
+    int counts[6] = { 0, 0, 0, 0, 0, 0 };
+    int total, most, pairs, run, longest, i;
+
+    total = 0;
+    for (i = 0 ; i < ctl_dice_count ; ++i) {
+	++counts[dice[i]];
+	total += dice[i] + 1;
+    }
+    most = pairs = run = longest = 0;
+    for (i = 0 ; i < 6 ; ++i) {
+	if (most < counts[i])
+	    most = counts[i];
+	if (counts[i] == 2)
+	    ++pairs;
+	run = counts[i] ? run + 1 : 0;
+	if (longest < run)
+	    longest = run;
+    }
+
+    switch (slot) {
+      case ctl_slot_ones:
+      case ctl_slot_twos:
+      case ctl_slot_threes:
+      case ctl_slot_fours:
+      case ctl_slot_fives:
+      case ctl_slot_sixes:
+	i = slot - ctl_slot_ones;
+	return (i + 1) * counts[i];
+      case ctl_slot_threeofakind:	return most >= 3 ? total : 0;
+      case ctl_slot_fourofakind:	return most >= 4 ? total : 0;
+      case ctl_slot_fullhouse:
+	return most == 5 || (most == 3 && pairs == 1) ? 25 : 0;
+      case ctl_slot_smallstraight:	return longest >= 4 ? 30 : 0;
+      case ctl_slot_largestraight:	return longest == 5 ? 40 : 0;
+      case ctl_slot_yahtzee:		return most == 5 ? 50 : 0;
+      case ctl_slot_chance:		return total;
+    }
+    return 0;
+}
+
+/* Verify the tables against every ordered roll of five dice, and
+ * verify that each size of roll has a total probability of one.
+ */
+static void checktables(void)
+{
+    int dice[ctl_dice_count];
+    double sums[ctl_dice_count + 1];
+    int seen[keep_count];
+    double sum;
+    hand h;
+    int roll, mask, block, rowcount, row, face, n, i;
+
+    for (roll = 0 ; roll < 6 * 6 * 6 * 6 * 6 ; ++roll) {
+	h = 0;
+	n = roll;
+	for (i = 0 ; i < ctl_dice_count ; ++i) {
+	    dice[i] = n % 6;
+	    n /= 6;
+	    handadddie(h, dice[i]);
+	}
+	n = t.handlowindices[h & 0777] + t.handhighindices[h >> 9];
+	if (t.handlist[n] != h)
+	    fail("hand %05o has index %d, which is hand %05o",
+		 h, n, t.handlist[n]);
+	for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	    if (t.handscores[n][i - ctl_slots] != checkscore(i, dice))
+		fail("hand %05o scores %d in slot %d instead of %d", h,
+		     t.handscores[n][i - ctl_slots], i, checkscore(i, dice));
+    }
+
+    for (n = 0 ; n < hand_count ; ++n) {
+	for (mask = 0 ; mask < 1 << ctl_dice_count ; ++mask) {
+	    h = t.keeplist[t.keepindices[n][mask]];
+	    for (i = 0 ; i < ctl_dice_count ; ++i)
+		if (mask & (1 << i))
+		    handremovedie(h, t.handdice[n][i]);
+	    if (h)
+		fail("keep %d of hand %05o has the wrong dice", mask,
+		     t.handlist[n]);
+	}
+    }
+
+    for (i = 0 ; i <= ctl_dice_count ; ++i)
+	sums[i] = 0.0;
+    for (n = 0 ; n < keep_count ; ++n)
+	sums[t.keepsizes[n]] += t.rollodds[n];
+    for (i = 0 ; i <= ctl_dice_count ; ++i)
+	if (fabs(sums[i] - 1.0) > 1e-12)
+	    fail("rolls of %d dice have a total probability of %.15f",
+		 i, sums[i]);
+
+    for (n = 0 ; n < keep_count ; ++n)
+	seen[n] = 0;
+    for (block = 0 ; block < transition_blockcount ; ++block) {
+	rowcount = t.transitionrowstart[block + 1]
+		 - t.transitionrowstart[block];
+	for (row = 0 ; row < rowcount ; ++row) {
+	    n = t.transitionkeeps[t.transitionrowstart[block] + row];
+	    if (t.keepsizes[n] != ctl_dice_count - block)
+		fail("keep %d is in transition block %d", n, block);
+	    ++seen[n];
+	    sum = 0.0;
+	    for (i = t.transitionentrystart[block] + row ;
+		 i < t.transitionentrystart[block + 1] ; i += rowcount) {
+		h = t.handlist[t.transitionhands[i]] - t.keeplist[n];
+		for (face = 0 ; face < 6 ; ++face)
+		    if (handcount(h, face) > 5)
+			fail("keep %d has a transition to hand %05o", n,
+			     t.handlist[t.transitionhands[i]]);
+		sum += t.transitionodds[i];
+	    }
+	    if (fabs(sum - 1.0) > 1e-12)
+		fail("keep %d has a total transition probability of %.15f",
+		     n, sum);
+	}
+    }
+    for (n = 0 ; n < keep_count ; ++n)
+	if (!seen[n])
+	    fail("keep %d is missing from the transition matrix", n);
+}
+
+/*
+ * Output.
+ */
+
+/* Output the elements of an integer array as C initializers.
+ */
+static void printints(char const *indent, int count,
+		      int (*element)(int), int width)
+{
+    int col, i;
+
+    col = 0;
+    for (i = 0 ; i < count ; ++i) {
+	if (col == 0)
+	    col = printf("%s", indent);
+	col += printf("%*d,", width, element(i));
+	if (col > 72 - width || i == count - 1) {
+	    putchar('\n');
+	    col = 0;
+	}
+    }
+}
+
+/* Accessors for the elements of each integer array. The row
+ * variable selects the row of the two-dimensional arrays.
+ */
+static int row;
+static int gethandlowindex(int i)  { return t.handlowindices[i]; }
+static int gethandhighindex(int i) { return t.handhighindices[i]; }
+static int getkeeplowindex(int i)  { return t.keeplowindices[i]; }
+static int getkeephighindex(int i) { return t.keephighindices[i]; }
+static int gethandlist(int i)	   { return t.handlist[i]; }
+static int getkeeplist(int i)	   { return t.keeplist[i]; }
+static int gethanddice(int i)	   { return t.handdice[row][i]; }
+static int gethandscores(int i)	   { return t.handscores[row][i]; }
+static int getkeepindices(int i)   { return t.keepindices[row][i]; }
+static int getkeepsizes(int i)	   { return t.keepsizes[i]; }
+static int gettransitionrowstart(int i)   { return t.transitionrowstart[i]; }
+static int gettransitionentrystart(int i) { return t.transitionentrystart[i]; }
+static int gettransitionkeeps(int i)	  { return t.transitionkeeps[i]; }
+static int gettransitionhands(int i)	  { return t.transitionhands[i]; }
+
+/* Output a two-dimensional integer array.
+ */
+static void printrows(int rowcount, int count, int (*element)(int),
+		      int width)
+{
+    for (row = 0 ; row < rowcount ; ++row) {
+	printf("    {\n");
+	printints("\t", count, element, width);
+	printf("    },\n");
+    }
+}
+
+/* Write out the tables as a C source file.
+ */
+static void printtables(void)
+{
+    int i;
+
+    printf("/* tables.c: Precomputed lookup tables.\n"
+	   " *\n"
+	   " * This file was generated by mktables. Do not edit.\n"
+	   " */\n\n"
+	   "#include \"yahtzee.h\"\n"
+	   "#include \"hand.h\"\n"
+	   "#include \"tables.h\"\n\n");
+
+    printf("unsigned char const handlowindices[512 + 3] = {\n");
+    printints("    ", 512 + 3, gethandlowindex, 3);
+    printf("};\n\nunsigned char const handhighindices[512 + 3] = {\n");
+    printints("    ", 512 + 3, gethandhighindex, 3);
+    printf("};\n\nunsigned short const keeplowindices[512] = {\n");
+    printints("    ", 512, getkeeplowindex, 3);
+    printf("};\n\nunsigned short const keephighindices[512] = {\n");
+    printints("    ", 512, getkeephighindex, 3);
+    printf("};\n\nhand const handlist[hand_count] = {\n");
+    printints("    ", hand_count, gethandlist, 6);
+    printf("};\n\nhand const keeplist[keep_count] = {\n");
+    printints("    ", keep_count, getkeeplist, 6);
+    printf("};\n\nunsigned char const handdice[hand_count]"
+	   "[ctl_dice_count] = {\n");
+    printrows(hand_count, ctl_dice_count, gethanddice, 1);
+    printf("};\n\nunsigned char const handscores[hand_count]"
+	   "[ctl_slots_count]\n    __attribute__((aligned(64))) = {\n");
+    printrows(hand_count, ctl_slots_count, gethandscores, 2);
+    printf("};\n\nunsigned short const keepindices[hand_count]"
+	   "[1 << ctl_dice_count] = {\n");
+    printrows(hand_count, 1 << ctl_dice_count, getkeepindices, 3);
+    printf("};\n\nunsigned char const keepsizes[keep_count] = {\n");
+    printints("    ", keep_count, getkeepsizes, 1);
+    printf("};\n\ndouble const rollodds[keep_count] = {\n");
+    for (i = 0 ; i < keep_count ; ++i)
+	printf("    %.17g,\n", t.rollodds[i]);
+    printf("};\n\nunsigned short const transitionrowstart"
+	   "[transition_blockcount + 1] = {\n");
+    printints("    ", transition_blockcount + 1, gettransitionrowstart, 5);
+    printf("};\n\nunsigned short const transitionentrystart"
+	   "[transition_blockcount + 1] = {\n");
+    printints("    ", transition_blockcount + 1, gettransitionentrystart, 5);
+    printf("};\n\nunsigned short const transitionkeeps"
+	   "[transition_rowcount] = {\n");
+    printints("    ", transition_rowcount, gettransitionkeeps, 3);
+    printf("};\n\nunsigned char const transitionhands"
+	   "[transition_entrycount] = {\n");
+    printints("    ", transition_entrycount, gettransitionhands, 3);
+    printf("};\n\ndouble const transitionodds[transition_entrycount]\n"
+	   "    __attribute__((aligned(32))) = {\n");
+    for (i = 0 ; i < transition_entrycount ; ++i)
+	printf("    %.17g,\n", t.transitionodds[i]);
+    printf("};\n");
+}
+
+/* Generate the tables, check them, and write them to stdout.
+ */
+int main(void)
+{
+    initscoring();
+    buildindices();
+    buildscores();
+    buildkeeps();
+    buildodds();
+    buildtransitions();
+    checktables();
+    printtables();
+    return ferror(stdout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
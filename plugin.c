@@ -0,0 +1,172 @@
+/* plugin.c: Policies loaded from plugins.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <dlfcn.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "yahtzeebot.h"
+#include "policy.h"
+#include "plugin.h"
+
+/* The number of states that are packed at once when passing them to
+ * a plugin.
+ */
+#define	packbatchsize		64
+
+/* A player for a plugin's policy, which is the plugin along with the
+ * plugin's own player.
+ */
+struct pluginplayer {
+    struct yahtzeebot const *bot;	/* the plugin */
+    void *player;			/* the plugin's player */
+};
+
+/* Create the plugin's player.
+ */
+static void *plugin_newplayer(struct policy const *policy,
+			      unsigned long long seed)
+{
+    struct pluginplayer *player;
+
+    player = allocate(sizeof *player);
+    player->bot = policy->data;
+    player->player = player->bot->newplayer ? player->bot->newplayer(seed)
+					    : NULL;
+    return player;
+}
+
+/* Free the plugin's player.
+ */
+static void plugin_freeplayer(void *data)
+{
+    struct pluginplayer *player = data;
+
+    if (player->bot->freeplayer)
+	player->bot->freeplayer(player->player);
+    free(player);
+}
+
+/* Pass the states to the plugin a batch at a time.
+ */
+static void plugin_choosekeeps(void *data, struct turnstate const *states,
+			       int *keepmasks, int count)
+{
+    struct pluginplayer *player = data;
+    unsigned long long packed[packbatchsize];
+    int i, n;
+
+    for ( ; count > 0 ; count -= n, states += n, keepmasks += n) {
+	n = count < packbatchsize ? count : packbatchsize;
+	for (i = 0 ; i < n ; ++i)
+	    packed[i] = packturnstate(states + i);
+	player->bot->choosekeeps(player->player, packed, keepmasks, n);
+    }
+}
+
+static void plugin_choosecategories(void *data,
+				    struct turnstate const *states,
+				    int *categories, int count)
+{
+    struct pluginplayer *player = data;
+    unsigned long long packed[packbatchsize];
+    int i, n;
+
+    for ( ; count > 0 ; count -= n, states += n, categories += n) {
+	n = count < packbatchsize ? count : packbatchsize;
+	for (i = 0 ; i < n ; ++i)
+	    packed[i] = packturnstate(states + i);
+	player->bot->choosecategories(player->player, packed, categories, n);
+    }
+}
+
+/* Make a single choice as a batch of one.
+ */
+static int plugin_choosekeep(void *player, struct turnstate const *state)
+{
+    int keepmask;
+
+    plugin_choosekeeps(player, state, &keepmask, 1);
+    return keepmask;
+}
+
+static int plugin_choosecategory(void *player, struct turnstate const *state)
+{
+    int category;
+
+    plugin_choosecategories(player, state, &category, 1);
+    return category;
+}
+
+/*
+ * Exported functions.
+ */
+
+/* The fields are laid out as in yahtzeebot.h.
+ */
+unsigned long long packturnstate(struct turnstate const *state)
+{
+    unsigned long long packed;
+    int i;
+
+    packed = 0;
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	packed |= (unsigned long long)state->dice[i] << (i * 3);
+    packed |= (unsigned long long)state->rerolls << 15;
+    packed |= (unsigned long long)state->mask << 17;
+    packed |= (unsigned long long)state->subtotal << 30;
+    packed |= (unsigned long long)state->score << 36;
+    return packed;
+}
+
+/* Open the shared object, find the plugin, and check that it was
+ * built for this version of the interface.
+ */
+struct policy const *loadplugin(char const *filename)
+{
+    struct yahtzeebot const *(*entry)(void);
+    struct yahtzeebot const *bot;
+    struct policy *policy;
+    void *handle;
+
+    handle = dlopen(filename, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+	fprintf(stderr, "%s\n", dlerror());
+	return NULL;
+    }
+    *(void**)&entry = dlsym(handle, "yahtzeebot");
+    if (!entry) {
+	fprintf(stderr, "%s: not a yahtzee plugin\n", filename);
+	dlclose(handle);
+	return NULL;
+    }
+    bot = entry();
+    if (!bot || bot->version != yahtzeebot_version) {
+	fprintf(stderr, "%s: built for version %d of the plugin interface,"
+			" not version %d\n",
+		filename, bot ? bot->version : 0, yahtzeebot_version);
+	dlclose(handle);
+	return NULL;
+    }
+    if (!bot->choosekeeps || !bot->choosecategories) {
+	fprintf(stderr, "%s: plugin is incomplete\n", filename);
+	dlclose(handle);
+	return NULL;
+    }
+
+    policy = allocate(sizeof *policy);
+    policy->name = bot->name;
+    policy->description = bot->description;
+    policy->newplayer = plugin_newplayer;
+    policy->freeplayer = plugin_freeplayer;
+    policy->choosekeep = plugin_choosekeep;
+    policy->choosecategory = plugin_choosecategory;
+    policy->choosekeeps = plugin_choosekeeps;
+    policy->choosecategories = plugin_choosecategories;
+    policy->data = bot;
+    return policy;
+}
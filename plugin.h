@@ -0,0 +1,23 @@
+/* plugin.h: Policies loaded from plugins.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _plugin_h_
+#define _plugin_h_
+
+/* Pack a turn state into the 64-bit form that plugins are given, as
+ * described in yahtzeebot.h. (This is not a position; see position.h
+ * for why the two differ.)
+ */
+extern unsigned long long packturnstate(struct turnstate const *state);
+
+/* Load a plugin from a shared object and return a policy that uses
+ * it. The plugin stays loaded for the life of the program. Returns
+ * NULL, after displaying an error message, if the plugin cannot be
+ * loaded.
+ */
+extern struct policy const *loadplugin(char const *filename);
+
+#endif
@@ -0,0 +1,355 @@
+/* policy.c: Strategies for playing without a human player.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "rng.h"
+#include "hand.h"
+#include "tables.h"
+#include "solver.h"
+#include "solution.h"
+#include "policy.h"
+#include "plugin.h"
+
+/*
+ * The optimal policy, which maximizes the expected score.
+ */
+
+/* The choices that optimal play makes during a turn, in a compact
+ * form: the category for each hand, and the dice to keep from each
+ * hand with one and with two rerolls left, as a mask over the hand's
+ * dice in ascending order.
+ */
+struct optimalturn {
+    unsigned char	categories[hand_count];
+    unsigned char	keeps[2][hand_count];
+};
+
+/* The choices for every turn-start state that has come up so far,
+ * indexed by state and shared by every player. Each entry is filled
+ * in by whichever thread first needs it, so after the first few
+ * thousand games nearly every choice is a lookup. If every state
+ * comes up, the entries take about 270 MB.
+ */
+static struct optimalturn **optimalturns = NULL;
+
+/* Return the choices for the turn, working them out if no thread has
+ * done so already. If two threads race to fill in the same entry, the
+ * loser discards its copy.
+ */
+static struct optimalturn const *optimalturn(struct turnstate const *state)
+{
+    struct optimalturn **turns, **prevturns, *turn, *prev;
+    struct turnpolicy policy;
+    int index, h, n, mask;
+
+    turns = __atomic_load_n(&optimalturns, __ATOMIC_ACQUIRE);
+    if (!turns) {
+	turns = allocate(state_count * sizeof *turns);
+	memset(turns, 0, state_count * sizeof *turns);
+	prevturns = NULL;
+	if (!__atomic_compare_exchange_n(&optimalturns, &prevturns, turns, 0,
+					 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+	    free(turns);
+	    turns = prevturns;
+	}
+    }
+    index = stateindex(state->mask, state->subtotal);
+    turn = __atomic_load_n(&turns[index], __ATOMIC_ACQUIRE);
+    if (turn)
+	return turn;
+
+    findturnpolicy(solution, state->mask, state->subtotal, &policy);
+    turn = allocate(sizeof *turn);
+    for (h = 0 ; h < hand_count ; ++h) {
+	turn->categories[h] = policy.categories[h];
+	for (n = 0 ; n < 2 ; ++n) {
+	    for (mask = (1 << ctl_dice_count) - 1 ; mask > 0 ; --mask)
+		if (keepindices[h][mask] == policy.keeps[n][h])
+		    break;
+	    turn->keeps[n][h] = mask;
+	}
+    }
+    prev = NULL;
+    if (!__atomic_compare_exchange_n(&turns[index], &prev, turn, 0,
+				     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+	free(turn);
+	turn = prev;
+    }
+    return turn;
+}
+
+/* Look up the keep for the dice, and find the positions of the dice
+ * that it contains.
+ */
+static int optimal_choosekeep(void *player, struct turnstate const *state)
+{
+    int order[ctl_dice_count];
+    int h, sortedmask, keepmask, i;
+
+    (void)player;
+    h = sortdice(state->dice, order);
+    sortedmask = optimalturn(state)->keeps[state->rerolls - 1][h];
+    keepmask = 0;
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	if (sortedmask & (1 << i))
+	    keepmask |= 1 << order[i];
+    return keepmask;
+}
+
+/* Look up the category for the dice.
+ */
+static int optimal_choosecategory(void *player, struct turnstate const *state)
+{
+    (void)player;
+    return optimalturn(state)->categories[sortdice(state->dice, NULL)];
+}
+
+static struct policy const optimalpolicy = {
+    "optimal", "maximize the expected score (needs the solution)",
+    NULL, NULL, optimal_choosekeep, optimal_choosecategory, NULL, NULL, NULL
+};
+
+/*
+ * The greedy policy, which only looks at the current turn.
+ */
+
+/* Keep the dice showing the most common face, preferring higher
+ * faces when there is a tie.
+ */
+static int greedy_choosekeep(void *player, struct turnstate const *state)
+{
+    int counts[6];
+    int best, keepmask, i;
+
+    (void)player;
+    memset(counts, 0, sizeof counts);
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	++counts[state->dice[i]];
+    best = 5;
+    for (i = 4 ; i >= 0 ; --i)
+	if (counts[i] > counts[best])
+	    best = i;
+    keepmask = 0;
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	if (state->dice[i] == best)
+	    keepmask |= 1 << i;
+    return keepmask;
+}
+
+/* Score the dice in whichever open category gives the most points.
+ */
+static int greedy_choosecategory(void *player, struct turnstate const *state)
+{
+    unsigned char const *scores;
+    int best, c;
+
+    (void)player;
+    scores = handscores[sortdice(state->dice, NULL)];
+    best = -1;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (state->mask & (1 << c))
+	    continue;
+	if (best < 0 || scores[categoryslots[c] - ctl_slots]
+				> scores[categoryslots[best] - ctl_slots])
+	    best = c;
+    }
+    return best;
+}
+
+static struct policy const greedypolicy = {
+    "greedy", "take the most points available each turn",
+    NULL, NULL, greedy_choosekeep, greedy_choosecategory, NULL, NULL, NULL
+};
+
+/*
+ * The heuristic policy, which follows a few rules of thumb.
+ */
+
+/* The number of points that is par for each category: three of a
+ * kind in the upper section (which is enough for the bonus), and
+ * about the average that optimal play scores in the lower section.
+ */
+static int const parpoints[category_count] = {
+    3, 6, 9, 12, 15, 18, 22, 13, 23, 30, 33, 16, 22
+};
+
+/* True if a category has not been used yet.
+ */
+#define	isopen(state, c)	(!((state)->mask & (1 << (c))))
+
+/* Find the longest run of consecutive faces among the dice, returning
+ * its length and storing its lowest face.
+ */
+static int longestrun(int const *counts, int *start)
+{
+    int best, length, face;
+
+    best = length = 0;
+    *start = 0;
+    for (face = 0 ; face < 6 ; ++face) {
+	length = counts[face] ? length + 1 : 0;
+	if (best < length) {
+	    best = length;
+	    *start = face - length + 1;
+	}
+    }
+    return best;
+}
+
+/* Keep a made Yahtzee, large straight or full house if its category
+ * is open, and a small straight if either straight is open (rerolling
+ * the odd die in the hope of a large one). Otherwise, draw to a
+ * straight when one is open and the dice show a run of at least
+ * three faces with no more than a pair; failing that, keep the dice
+ * showing the most common face, preferring faces whose upper
+ * category is open and then higher faces.
+ */
+static int heuristic_choosekeep(void *player, struct turnstate const *state)
+{
+    unsigned char const *scores;
+    int counts[6];
+    int best, run, start, keepmask, face, i;
+
+    (void)player;
+    scores = handscores[sortdice(state->dice, NULL)];
+    if ((isopen(state, 11) && scores[ctl_slot_yahtzee - ctl_slots])
+		|| (isopen(state, 10)
+			&& scores[ctl_slot_largestraight - ctl_slots])
+		|| (isopen(state, 8) && scores[ctl_slot_fullhouse - ctl_slots])
+		|| (isopen(state, 9) && !isopen(state, 10)
+			&& scores[ctl_slot_smallstraight - ctl_slots]))
+	return (1 << ctl_dice_count) - 1;
+
+    memset(counts, 0, sizeof counts);
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	++counts[state->dice[i]];
+    best = 5;
+    for (face = 4 ; face >= 0 ; --face)
+	if (counts[face] > counts[best] || (counts[face] == counts[best]
+				&& isopen(state, face) && !isopen(state, best)))
+	    best = face;
+
+    keepmask = 0;
+    run = longestrun(counts, &start);
+    if ((isopen(state, 9) || isopen(state, 10)) && run >= 3
+						&& counts[best] <= 2) {
+	for (face = start ; face < start + run ; ++face) {
+	    for (i = 0 ; state->dice[i] != face ; ++i) ;
+	    keepmask |= 1 << i;
+	}
+	return keepmask;
+    }
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	if (state->dice[i] == best)
+	    keepmask |= 1 << i;
+    return keepmask;
+}
+
+/* Score the dice in whichever open category gives the most points
+ * compared to that category's par. Until the bonus is earned, points
+ * above or below par in the upper section count double.
+ */
+static int heuristic_choosecategory(void *player,
+				    struct turnstate const *state)
+{
+    unsigned char const *scores;
+    int best, bestvalue, value, c;
+
+    (void)player;
+    scores = handscores[sortdice(state->dice, NULL)];
+    best = -1;
+    bestvalue = 0;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (!isopen(state, c))
+	    continue;
+	value = scores[categoryslots[c] - ctl_slots] - parpoints[c];
+	if (c < 6 && state->subtotal < 63)
+	    value *= 2;
+	if (best < 0 || value > bestvalue) {
+	    best = c;
+	    bestvalue = value;
+	}
+    }
+    return best;
+}
+
+static struct policy const heuristicpolicy = {
+    "heuristic", "follow rules of thumb for keeping dice",
+    NULL, NULL, heuristic_choosekeep, heuristic_choosecategory,
+    NULL, NULL, NULL
+};
+
+/*
+ * The random policy, which serves as a baseline.
+ */
+
+/* The player is the state of its random-number generator.
+ */
+static void *random_newplayer(struct policy const *policy,
+			      unsigned long long seed)
+{
+    struct rng *player;
+
+    (void)policy;
+    player = allocate(sizeof *player);
+    rngseed(player, seed, 0);
+    return player;
+}
+
+/* Keep a random selection of the dice.
+ */
+static int random_choosekeep(void *player, struct turnstate const *state)
+{
+    (void)state;
+    return rngbelow(player, 1 << ctl_dice_count);
+}
+
+/* Pick one of the open categories at random.
+ */
+static int random_choosecategory(void *player, struct turnstate const *state)
+{
+    int n, c;
+
+    n = rngbelow(player, category_count - __builtin_popcount(state->mask));
+    for (c = 0 ; c < category_count ; ++c)
+	if (!(state->mask & (1 << c)) && n-- == 0)
+	    break;
+    return c;
+}
+
+static struct policy const randompolicy = {
+    "random", "make every choice at random",
+    random_newplayer, free, random_choosekeep, random_choosecategory,
+    NULL, NULL, NULL
+};
+
+/*
+ * Exported functions.
+ */
+
+/* The list of built-in policies.
+ */
+struct policy const *const policies[] = {
+    &optimalpolicy, &heuristicpolicy, &greedypolicy, &randompolicy, NULL
+};
+
+/* Search the list by name.
+ */
+struct policy const *findpolicy(char const *name)
+{
+    int i;
+
+    if (ispluginname(name))
+	return loadplugin(name);
+    for (i = 0 ; policies[i] ; ++i)
+	if (!strcmp(policies[i]->name, name))
+	    return policies[i];
+    return NULL;
+}
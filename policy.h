@@ -0,0 +1,62 @@
+/* policy.h: Strategies for playing without a human player.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _policy_h_
+#define _policy_h_
+
+/* The state of a game as seen by a policy when it has to make a
+ * choice. The subtotal is capped at 63, as in the solver.
+ */
+struct turnstate {
+    int			mask;		/* the categories used so far */
+    int			subtotal;	/* the upper section's subtotal */
+    int			score;		/* the total score so far */
+    int			rerolls;	/* the rerolls left this turn */
+    unsigned char	dice[ctl_dice_count]; /* the faces showing, 0 to 5 */
+};
+
+/* A policy is a set of functions that choose moves. Each thread that
+ * plays games with a policy gets its own player, which is created by
+ * newplayer() (given the policy, and a seed for any random choices it
+ * makes) and passed to the other functions. choosekeep() returns a
+ * bitmask of the positions of the dice to keep; keeping all five dice
+ * ends the rolling for the turn. choosecategory() returns the open
+ * category in which to score the dice. newplayer() and freeplayer()
+ * may be NULL if the policy needs no state. choosekeeps() and
+ * choosecategories() make the same choices for count states at once,
+ * and may be NULL for policies that gain nothing from it.
+ */
+struct policy {
+    char const *name;			/* the policy's name */
+    char const *description;		/* a one-line description */
+    void *(*newplayer)(struct policy const *policy, unsigned long long seed);
+    void (*freeplayer)(void *player);
+    int (*choosekeep)(void *player, struct turnstate const *state);
+    int (*choosecategory)(void *player, struct turnstate const *state);
+    void (*choosekeeps)(void *player, struct turnstate const *states,
+			int *keepmasks, int count);
+    void (*choosecategories)(void *player, struct turnstate const *states,
+			     int *categories, int count);
+    void const *data;			/* data belonging to the policy */
+};
+
+/* The built-in policies, ending with a NULL.
+ */
+extern struct policy const *const policies[];
+
+/* True if a policy name is the filename of a plugin, which is any
+ * name containing a slash.
+ */
+#define	ispluginname(name)	(strchr((name), '/') != NULL)
+
+/* Return the built-in policy with the given name, or NULL if there
+ * is none. A plugin's filename is loaded instead; if that fails, an
+ * error message has already been displayed when NULL is returned.
+ * The optimal policy requires a solution table to be loaded first.
+ */
+extern struct policy const *findpolicy(char const *name);
+
+#endif
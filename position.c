@@ -0,0 +1,151 @@
+/* position.c: The packed representation of a game in progress.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include "yahtzee.h"
+#include "hand.h"
+#include "tables.h"
+#include "solver.h"
+#include "scoring.h"
+#include "engine.h"
+#include "position.h"
+
+/* Where each category's points are stored in a position. A category
+ * stores its points divided by the unit, so the upper categories
+ * store a number of dice, and the categories with a fixed score store
+ * a single bit.
+ */
+struct positionfield {
+    unsigned char shift;	/* the position of the field's lowest bit */
+    unsigned char width;	/* the number of bits in the field */
+    unsigned char unit;		/* the number of points per unit */
+};
+
+static struct positionfield const fields[category_count] = {
+    { 13, 3, 1 }, { 16, 3, 2 }, { 19, 3, 3 },
+    { 22, 3, 4 }, { 25, 3, 5 }, { 28, 3, 6 },
+    { 31, 5, 1 }, { 36, 5, 1 },
+    { 46, 1, 25 }, { 47, 1, 30 }, { 48, 1, 40 }, { 49, 1, 50 },
+    { 41, 5, 1 }
+};
+
+/*
+ * Exported functions.
+ */
+
+/* Extract a category's field and scale it back up.
+ */
+int positionpoints(position pos, int category)
+{
+    return fields[category].unit * ((int)(pos >> fields[category].shift)
+				     & ((1 << fields[category].width) - 1));
+}
+
+/* Add up the upper categories.
+ */
+int positionsubtotal(position pos)
+{
+    int subtotal, c;
+
+    subtotal = 0;
+    for (c = 0 ; c < 6 ; ++c)
+	subtotal += positionpoints(pos, c);
+    return subtotal;
+}
+
+/* Add up every category, and the bonus if it was earned.
+ */
+int positionscore(position pos)
+{
+    int score, c;
+
+    score = positionsubtotal(pos) >= 63 ? 35 : 0;
+    for (c = 0 ; c < category_count ; ++c)
+	score += positionpoints(pos, c);
+    return score;
+}
+
+/* The used categories are the disabled slots, as in the advisor. The
+ * dice are only read once they have been rolled.
+ */
+position packposition(struct game const *game)
+{
+    struct control const *controls = game->controls;
+    position pos;
+    hand h;
+    int c, i;
+
+    pos = 0;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (!isdisabled(controls[categoryslots[c]]))
+	    continue;
+	pos |= 1ULL << c;
+	pos |= (position)(controls[categoryslots[c]].value / fields[c].unit)
+						<< fields[c].shift;
+    }
+    if (game->rollcount) {
+	h = 0;
+	for (i = ctl_dice ; i < ctl_dice_end ; ++i)
+	    handadddie(h, controls[i].value);
+	pos |= (position)handindex(h) << 50;
+    }
+    pos |= (position)game->rollcount << 58;
+    if (game->selectedslot >= 0) {
+	for (c = 0 ; categoryslots[c] != game->selectedslot ; ++c) ;
+	pos |= (position)(c + 1) << 60;
+    }
+    return pos;
+}
+
+/* Rebuild the controls and the running totals from scratch, marking
+ * every control as modified so that the user interface redraws it.
+ * The open slots are scored by updateopenslots(), just as when the
+ * dice are rolled, and the button is then set by the engine, just
+ * as after a move. The dice stay frozen after the third roll even
+ * once the game is over, as they do in play.
+ */
+void unpackposition(struct game *game, position pos)
+{
+    struct control *controls = game->controls;
+    unsigned char const *dice;
+    int selected, slot, c, i;
+
+    resetscores(game);
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
+	controls[i].value = -1;
+	controls[i].flags = ctlflag_modified;
+	if (!controls[i].key)
+	    controls[i].flags |= ctlflag_disabled;
+    }
+    for (c = 0 ; c < category_count ; ++c) {
+	if (!(positionmask(pos) & (1 << c)))
+	    continue;
+	slot = categoryslots[c];
+	controls[slot].value = positionpoints(pos, c);
+	controls[slot].flags |= ctlflag_disabled;
+	markslotused(game, slot);
+    }
+
+    game->rollcount = positionrollcount(pos);
+    dice = handdice[positionhand(pos)];
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+	controls[i].value = game->rollcount ? dice[i - ctl_dice] : -1;
+	controls[i].flags = ctlflag_modified;
+	if (game->rollcount == 3)
+	    controls[i].flags |= ctlflag_disabled;
+    }
+    if (game->rollcount)
+	updateopenslots(game);
+
+    selected = positionselected(pos);
+    if (selected >= 0) {
+	controls[categoryslots[selected]].flags |= ctlflag_selected;
+	markslotselected(game, categoryslots[selected]);
+    }
+    updatescores(game);
+    controls[ctl_button].flags = ctlflag_modified;
+    updatecontrols(game);
+}
@@ -0,0 +1,76 @@
+/* position.h: The packed representation of a game in progress.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _position_h_
+#define _position_h_
+
+/* A position is the state of a game packed into a single word:
+ *
+ * bits 0-12:  the categories used so far
+ * bits 13-30: the number of dice scored in each upper category,
+ *             three bits each
+ * bits 31-45: the points scored in three of a kind, four of a kind,
+ *             and chance, five bits each
+ * bits 46-49: whether full house, small straight, large straight,
+ *             and Yahtzee were scored for points, one bit each
+ * bits 50-57: the index of the hand showing on the dice
+ * bits 58-59: the number of times the dice have been rolled this turn
+ * bits 60-63: the selected category plus one, or zero if none is
+ *
+ * The fields of an unused category are zero, and so is the hand
+ * before the first roll of a game. The dice are stored as a hand, so
+ * positions can be compared and hashed as plain integers without
+ * regard to the order of the dice. Which dice are marked for
+ * rerolling is not part of the position.
+ *
+ * This is not the same word that plugins are given (see
+ * yahtzeebot.h and packturnstate()), and the two serve different
+ * ends. A plugin answers with a mask over the positions of the dice,
+ * so its word keeps each die in place, and it is given the subtotal
+ * and the score directly rather than the points in each category.
+ * That word is part of the plugin interface and cannot change
+ * without breaking plugins. A position instead keeps the whole score
+ * sheet and the selected slot, so that a game can be rebuilt from
+ * it, and stores the dice as a hand so that equal positions are
+ * equal integers.
+ */
+typedef unsigned long long position;
+
+/* The fields that can be read directly. The selected category is -1
+ * if no category is selected.
+ */
+#define	positionmask(pos)	((int)(pos) & 0x1FFF)
+#define	positionhand(pos)	((int)((pos) >> 50) & 0xFF)
+#define	positionrollcount(pos)	((int)((pos) >> 58) & 3)
+#define	positionselected(pos)	((int)((pos) >> 60) - 1)
+
+/* Return the points scored in a used category, or zero if the
+ * category has not been used.
+ */
+extern int positionpoints(position pos, int category);
+
+/* Return the upper section's subtotal, which is not capped.
+ */
+extern int positionsubtotal(position pos);
+
+/* Return the total score so far, including the bonus.
+ */
+extern int positionscore(position pos);
+
+/* Pack the state of a game into a position.
+ */
+extern position packposition(struct game const *game);
+
+/* Set up a game from a position. The controls are left as they would
+ * be after the game had reached the position, with the dice in
+ * ascending order and none of them marked for rerolling: the dice are
+ * frozen after the third roll, and the button is labeled and enabled
+ * as updatecontrols() would leave it. The hotkeys and the source of
+ * the dice are not changed.
+ */
+extern void unpackposition(struct game *game, position pos);
+
+#endif
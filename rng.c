@@ -0,0 +1,301 @@
+/* rng.c: Random numbers for rolling dice.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include "rng.h"
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define RNG_SIMD
+#include <immintrin.h>
+#endif
+
+/* Rotate a word left.
+ */
+#define	rotl(x, k)	((x) << (k) | (x) >> (64 - (k)))
+
+/* Pointer to the selected implementation of rngfill().
+ */
+static void (*fill)(struct rngbatch *batch, unsigned char *dice,
+		    int count);
+
+/* The splitmix64 generator, which is used to spread a seed out over
+ * the generator's state, so that similar seeds give unrelated
+ * sequences.
+ */
+static unsigned long long splitmix(unsigned long long *x)
+{
+    unsigned long long z;
+
+    z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/* Advance a generator by 2^128 steps.
+ */
+static void rngjump(struct rng *rng)
+{
+    static unsigned long long const jump[4] = {
+	0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+	0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+    unsigned long long s[4];
+    int i, b;
+
+    s[0] = s[1] = s[2] = s[3] = 0;
+    for (i = 0 ; i < 4 ; ++i) {
+	for (b = 0 ; b < 64 ; ++b) {
+	    if (jump[i] & (1ULL << b)) {
+		s[0] ^= rng->s[0];
+		s[1] ^= rng->s[1];
+		s[2] ^= rng->s[2];
+		s[3] ^= rng->s[3];
+	    }
+	    rngnext(rng);
+	}
+    }
+    rng->s[0] = s[0];
+    rng->s[1] = s[1];
+    rng->s[2] = s[2];
+    rng->s[3] = s[3];
+}
+
+/* Fill the state from the seed, and jump ahead once per stream.
+ */
+void rngseed(struct rng *rng, unsigned long long seed, int stream)
+{
+    int i;
+
+    for (i = 0 ; i < 4 ; ++i)
+	rng->s[i] = splitmix(&seed);
+    while (stream-- > 0)
+	rngjump(rng);
+}
+
+/* The xoshiro256** step.
+ */
+unsigned long long rngnext(struct rng *rng)
+{
+    unsigned long long *s = rng->s;
+    unsigned long long result, t;
+
+    result = rotl(s[1] * 5, 7) * 9;
+    t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+/* Scale 32 random bits by multiplying, rejecting the few values that
+ * would make the low results more likely than the high ones.
+ */
+unsigned int rngbelow(struct rng *rng, unsigned long long n)
+{
+    unsigned long long m;
+    unsigned int threshold;
+
+    m = (rngnext(rng) >> 32) * n;
+    if ((unsigned int)m < n) {
+	threshold = (0x100000000ULL - n) % n;
+	while ((unsigned int)m < threshold)
+	    m = (rngnext(rng) >> 32) * n;
+    }
+    return m >> 32;
+}
+
+/* Use each half of a 64-bit number for a separate die, in the same
+ * manner as rngbelow(). Since 2^32 leaves a remainder of 4 when
+ * divided by 6, a half is only rejected if its scaled low word is
+ * less than 4.
+ */
+void rngdice(struct rng *rng, unsigned char *dice, int count)
+{
+    unsigned long long bits, m;
+    int halves, n;
+
+    bits = 0;
+    halves = 0;
+    n = 0;
+    while (n < count) {
+	if (!halves) {
+	    bits = rngnext(rng);
+	    halves = 2;
+	}
+	m = (bits & 0xFFFFFFFFULL) * 6;
+	bits >>= 32;
+	--halves;
+	if ((unsigned int)m >= 4)
+	    dice[n++] = m >> 32;
+    }
+}
+
+/*
+ * The batch generator. Each step advances all four generators, and
+ * splits each of their outputs into four 16-bit numbers, which are
+ * turned into dice in the same manner as rngdice(). (Since 2^16 also
+ * leaves a remainder of 4 when divided by 6, the rejections are rare
+ * enough that the vectorized code treats them as a special case.) So
+ * each step produces up to sixteen dice.
+ */
+
+/* Advance generator j of the batch one step, one word at a time.
+ */
+static unsigned long long batchnext(struct rngbatch *batch, int j)
+{
+    unsigned long long (*s)[4] = batch->s;
+    unsigned long long result, t;
+
+    result = rotl(s[1][j] * 5, 7) * 9;
+    t = s[1][j] << 17;
+    s[2][j] ^= s[0][j];
+    s[3][j] ^= s[1][j];
+    s[1][j] ^= s[2][j];
+    s[0][j] ^= s[3][j];
+    s[2][j] ^= t;
+    s[3][j] = rotl(s[3][j], 45);
+    return result;
+}
+
+/* Produce the dice one at a time.
+ */
+static void scalar_rngfill(struct rngbatch *batch, unsigned char *dice,
+			   int count)
+{
+    unsigned long long bits;
+    unsigned int m;
+    int n, j, k;
+
+    n = 0;
+    while (n < count) {
+	for (j = 0 ; j < 4 ; ++j) {
+	    bits = batchnext(batch, j);
+	    for (k = 0 ; k < 4 && n < count ; ++k, bits >>= 16) {
+		m = (unsigned int)(bits & 0xFFFF) * 6;
+		if ((m & 0xFFFF) >= 4)
+		    dice[n++] = m >> 16;
+	    }
+	}
+    }
+}
+
+#ifdef RNG_SIMD
+
+/* Rotate each 64-bit element of a vector left.
+ */
+#define	rotl256(x, k)	\
+    _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - (k)))
+
+/* Run the four generators in one set of registers, and multiply all
+ * sixteen numbers by six at once. The high halves of the products
+ * are the dice, and a low half below 4 marks a rejection. When there
+ * are none, the dice are packed down to bytes and stored together;
+ * otherwise, and at the end of the buffer, they are copied one at a
+ * time. The multiplications by 5 and 9 are done with shifts, as AVX2
+ * has no 64-bit multiply. (As elsewhere, the upper halves of the
+ * registers are cleared explicitly before returning.)
+ */
+__attribute__((target("avx2")))
+static void avx2_rngfill(struct rngbatch *batch, unsigned char *dice,
+			 int count)
+{
+    unsigned short faces[16];
+    __m256i s0, s1, s2, s3, t, r, lo, hi, six, lowmask, zero;
+    __m128i packed;
+    int rejects, n, k;
+
+    s0 = _mm256_loadu_si256((__m256i const*)batch->s[0]);
+    s1 = _mm256_loadu_si256((__m256i const*)batch->s[1]);
+    s2 = _mm256_loadu_si256((__m256i const*)batch->s[2]);
+    s3 = _mm256_loadu_si256((__m256i const*)batch->s[3]);
+    six = _mm256_set1_epi16(6);
+    lowmask = _mm256_set1_epi16(~3);
+    zero = _mm256_setzero_si256();
+
+    n = 0;
+    while (n < count) {
+	r = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+	r = rotl256(r, 7);
+	r = _mm256_add_epi64(_mm256_slli_epi64(r, 3), r);
+	t = _mm256_slli_epi64(s1, 17);
+	s2 = _mm256_xor_si256(s2, s0);
+	s3 = _mm256_xor_si256(s3, s1);
+	s1 = _mm256_xor_si256(s1, s2);
+	s0 = _mm256_xor_si256(s0, s3);
+	s2 = _mm256_xor_si256(s2, t);
+	s3 = rotl256(s3, 45);
+
+	hi = _mm256_mulhi_epu16(r, six);
+	lo = _mm256_mullo_epi16(r, six);
+	rejects = _mm256_movemask_epi8(
+			_mm256_cmpeq_epi16(_mm256_and_si256(lo, lowmask), zero));
+	if (!rejects && count - n >= 16) {
+	    hi = _mm256_packus_epi16(hi, hi);
+	    packed = _mm_unpacklo_epi64(_mm256_castsi256_si128(hi),
+					_mm256_extracti128_si256(hi, 1));
+	    _mm_storeu_si128((__m128i*)(dice + n), packed);
+	    n += 16;
+	} else {
+	    _mm256_storeu_si256((__m256i*)faces, hi);
+	    for (k = 0 ; k < 16 && n < count ; ++k)
+		if (!(rejects & (1 << (k * 2))))
+		    dice[n++] = faces[k];
+	}
+    }
+
+    _mm256_storeu_si256((__m256i*)batch->s[0], s0);
+    _mm256_storeu_si256((__m256i*)batch->s[1], s1);
+    _mm256_storeu_si256((__m256i*)batch->s[2], s2);
+    _mm256_storeu_si256((__m256i*)batch->s[3], s3);
+    _mm256_zeroupper();
+}
+
+#endif
+
+/* Give each generator in the batch its own seed.
+ */
+void rngbatchseed(struct rngbatch *batch, struct rng *rng)
+{
+    struct rng lane;
+    int i, j;
+
+    for (j = 0 ; j < 4 ; ++j) {
+	rngseed(&lane, rngnext(rng), 0);
+	for (i = 0 ; i < 4 ; ++i)
+	    batch->s[i][j] = lane.s[i];
+    }
+}
+
+/* Choose the implementation of rngfill(), if the CPU supports it.
+ */
+int selectrngfill(int method)
+{
+    switch (method) {
+      case rngfill_scalar:
+	fill = scalar_rngfill;
+	return 1;
+#ifdef RNG_SIMD
+      case rngfill_avx2:
+	if (!__builtin_cpu_supports("avx2"))
+	    return 0;
+	fill = avx2_rngfill;
+	return 1;
+#endif
+    }
+    return 0;
+}
+
+/* Select the fastest implementation the first time through.
+ */
+void rngfill(struct rngbatch *batch, unsigned char *dice, int count)
+{
+    if (!fill && !selectrngfill(rngfill_avx2))
+	selectrngfill(rngfill_scalar);
+    fill(batch, dice, count);
+}
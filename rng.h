@@ -0,0 +1,71 @@
+/* rng.h: Random numbers for rolling dice.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _rng_h_
+#define _rng_h_
+
+/* The state of a random-number generator (xoshiro256**). Each thread
+ * that rolls dice should have its own generator.
+ */
+struct rng {
+    unsigned long long	s[4];
+};
+
+/* Seed a generator. Generators given the same seed and different
+ * stream numbers produce independent sequences (each stream starts
+ * 2^128 numbers further along than the last), so one seed can supply
+ * any number of threads.
+ */
+extern void rngseed(struct rng *rng, unsigned long long seed, int stream);
+
+/* Return the next 64 random bits.
+ */
+extern unsigned long long rngnext(struct rng *rng);
+
+/* Return a random number from 0 up to but not including n, which
+ * must be between 1 and 2^32. Every value is equally likely.
+ */
+extern unsigned int rngbelow(struct rng *rng, unsigned long long n);
+
+/* Roll a single die, returning a face from 0 to 5.
+ */
+#define	rngdie(rng)	((int)rngbelow(rng, 6))
+
+/* Roll count dice at once, storing faces from 0 to 5. This uses
+ * fewer random bits per die than rolling them one at a time.
+ */
+extern void rngdice(struct rng *rng, unsigned char *dice, int count);
+
+/* A batch generator runs four generators side by side, for filling
+ * large buffers with dice. s[i][j] is word i of generator j's state.
+ */
+struct rngbatch {
+    unsigned long long	s[4][4];
+};
+
+/* The list of available implementations of rngfill().
+ */
+enum { rngfill_scalar, rngfill_avx2, rngfill_count };
+
+/* Seed a batch generator from the next numbers of a generator.
+ */
+extern void rngbatchseed(struct rngbatch *batch, struct rng *rng);
+
+/* Select a specific implementation of rngfill(). Returns false if the
+ * implementation is not available on this machine. If none is
+ * selected, the fastest one is used.
+ */
+extern int selectrngfill(int method);
+
+/* Fill a buffer with count dice, storing faces from 0 to 5. Every
+ * implementation produces the same dice from the same state. Each
+ * call uses up a whole number of steps of the generators, so filling
+ * a buffer in pieces gives different dice than filling it all at
+ * once.
+ */
+extern void rngfill(struct rngbatch *batch, unsigned char *dice, int count);
+
+#endif
@@ -4,169 +4,275 @@
  * This program is free software. See README for details.
  */
 
+#include <string.h>
 #include "yahtzee.h"
+#include "hand.h"
+#include "tables.h"
 #include "scoring.h"
 
-/* The score-evaluation functions for each slot.
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define SCORING_SIMD
+#include <immintrin.h>
+#endif
+
+/* Pointer to the selected implementation of scorehands().
  */
-static int (*slotevalfunctions[ctl_count])(int[6]);
+void (*scorehands)(unsigned char const (*hands)[ctl_dice_count],
+		   unsigned char (*scores)[ctl_slots_count], int count);
 
-/*
- * The individual scoring functions for each slot. Each function
- * accepts an array of 6 ints, each int indicating the number of dice
- * currently showing that value. The return value is the number of
- * points that the dice values would currently earn for that slot.
+/* The bit representing a slot in a bitmask of slots, and the mask of
+ * the lower slots, whose scores depend on every die.
  */
+#define	slotbit(ctl)	(1 << ((ctl) - ctl_slots))
+#define	lowerslotsmask	((slotbit(ctl_slot_chance + 1) - 1) & \
+			 ~(slotbit(ctl_slot_threeofakind) - 1))
 
-static int ones(int values[6])   { return 1 * values[0]; }
-static int twos(int values[6])   { return 2 * values[1]; }
-static int threes(int values[6]) { return 3 * values[2]; }
-static int fours(int values[6])  { return 4 * values[3]; }
-static int fives(int values[6])  { return 5 * values[4]; }
-static int sixes(int values[6])  { return 6 * values[5]; }
+/*
+ * The implementations of scorehands().
+ */
 
-static int chance(int values[6])
+/* Look up the scores for each hand one at a time.
+ */
+static void scalar_scorehands(unsigned char const (*hands)[ctl_dice_count],
+			      unsigned char (*scores)[ctl_slots_count],
+			      int count)
 {
-    int total, i;
+    hand h;
+    int n, i;
 
-    total = 0;
-    for (i = 0 ; i < 6 ; ++i)
-	total += (i + 1) * values[i];
-    return total;
+    for (n = 0 ; n < count ; ++n) {
+	h = 0;
+	for (i = 0 ; i < ctl_dice_count ; ++i)
+	    handadddie(h, hands[n][i]);
+	memcpy(scores[n], handscores[handindex(h)], ctl_slots_count);
+    }
 }
 
-static int threeofakind(int values[6])
+#ifdef SCORING_SIMD
+
+/* Look up the scores for each hand, moving each hand's row of scores
+ * through a single 16-byte register.
+ */
+__attribute__((target("sse2")))
+static void sse2_scorehands(unsigned char const (*hands)[ctl_dice_count],
+			    unsigned char (*scores)[ctl_slots_count],
+			    int count)
 {
-    int i;
+    __m128i row;
+    hand h;
+    int n;
 
-    for (i = 0 ; i < 6 ; ++i)
-	if (values[i] >= 3)
-	    return chance(values);
-    return 0;
+    for (n = 0 ; n < count ; ++n) {
+	h = handdie(hands[n][0]) + handdie(hands[n][1]) + handdie(hands[n][2])
+	  + handdie(hands[n][3]) + handdie(hands[n][4]);
+	row = _mm_load_si128((__m128i const*)handscores[handindex(h)]);
+	_mm_storeu_si128((__m128i*)scores[n], row);
+    }
 }
 
-static int fourofakind(int values[6])
+/* Compute the hands and table indexes of eight hands at a time, using
+ * gathers to pull each die out of the array of hands. Since a gather
+ * reads four bytes, the vector loop stops while there is still at
+ * least one more hand after the last one read, and the remaining
+ * hands are handled by the scalar loop. (The upper halves of the
+ * registers are cleared explicitly, since gcc omits this when
+ * optimizing for size.)
+ */
+__attribute__((target("avx2")))
+static void avx2_scorehands(unsigned char const (*hands)[ctl_dice_count],
+			    unsigned char (*scores)[ctl_slots_count],
+			    int count)
 {
-    int i;
+    int indexes[8] __attribute__((aligned(32)));
+    __m256i offsets, bytemask, ninebits, one, h, die, index;
+    int n, i;
 
-    for (i = 0 ; i < 6 ; ++i)
-	if (values[i] >= 4)
-	    return chance(values);
-    return 0;
+    offsets = _mm256_setr_epi32(0, 5, 10, 15, 20, 25, 30, 35);
+    bytemask = _mm256_set1_epi32(0xFF);
+    ninebits = _mm256_set1_epi32(0777);
+    one = _mm256_set1_epi32(1);
+    for (n = 0 ; n + 8 < count ; n += 8) {
+	h = _mm256_setzero_si256();
+	for (i = 0 ; i < ctl_dice_count ; ++i) {
+	    die = _mm256_i32gather_epi32((int const*)&hands[n][i],
+					 offsets, 1);
+	    die = _mm256_and_si256(die, bytemask);
+	    die = _mm256_add_epi32(die, _mm256_add_epi32(die, die));
+	    h = _mm256_add_epi32(h, _mm256_sllv_epi32(one, die));
+	}
+	index = _mm256_add_epi32(
+		_mm256_i32gather_epi32((int const*)handlowindices,
+				       _mm256_and_si256(h, ninebits), 1),
+		_mm256_i32gather_epi32((int const*)handhighindices,
+				       _mm256_srli_epi32(h, 9), 1));
+	index = _mm256_and_si256(index, bytemask);
+	_mm256_store_si256((__m256i*)indexes, index);
+	for (i = 0 ; i < 8 ; ++i)
+	    _mm_storeu_si128((__m128i*)scores[n + i],
+			     _mm_load_si128((__m128i const*)
+					    handscores[indexes[i]]));
+    }
+    _mm256_zeroupper();
+    scalar_scorehands(hands + n, scores + n, count - n);
 }
 
-static int yahtzee(int values[6])
-{
-    int i;
+#endif
 
-    for (i = 0 ; i < 6 ; ++i)
-	if (values[i] == 5)
-	    return 50;
-    return 0;
-}
+/*
+ * Exported functions.
+ */
 
-static int fullhouse(int values[6])
+/* Select the fastest implementation of scorehands(). (The scoring
+ * tables themselves are generated at build time.)
+ */
+void initscoring(void)
 {
-    int count, i;
-
-    count = 0;
-    for (i = 0 ; i < 6 ; ++i) {
-	switch (values[i]) {
-	  case 0:	continue;
-	  case 1:	return 0;
-	  case 4:	return 0;
-	  case 5:	return 25;
-	  default:	count += values[i];
-	}
-    }
-    return count == 5 ? 25 : 0;
+    if (!selectscoring(scoring_avx2) && !selectscoring(scoring_sse2))
+	selectscoring(scoring_scalar);
 }
 
-static int smallstraight(int values[6])
+/* Choose the implementation of scorehands(), if the CPU supports it.
+ */
+int selectscoring(int method)
 {
-    if (values[2] && values[3])
-	if ((values[0] && values[1]) || (values[1] && values[4])
-				     || (values[4] && values[5]))
-	    return 30;
+    switch (method) {
+      case scoring_scalar:
+	scorehands = scalar_scorehands;
+	return 1;
+#ifdef SCORING_SIMD
+      case scoring_sse2:
+	if (!__builtin_cpu_supports("sse2"))
+	    return 0;
+	scorehands = sse2_scorehands;
+	return 1;
+      case scoring_avx2:
+	if (!__builtin_cpu_supports("avx2"))
+	    return 0;
+	scorehands = avx2_scorehands;
+	return 1;
+#endif
+    }
     return 0;
 }
 
-static int largestraight(int values[6])
+/* Compute the score for each open slot using the current dice. Only
+ * the dice flagged as modified are examined, and each one that has
+ * changed value is moved from its old face to its new face in the
+ * current hand. The upper slots for those two faces, and all of the
+ * lower slots, are then rescored. Open slots holding a negative
+ * value have not been scored since they were cleared, and so are
+ * rescored as well.
+ */
+void updateopenslots(struct game *game)
 {
-    if (values[1] == 1 && values[2] == 1 && values[3] == 1 && values[4] == 1)
-	return 40;
-    return 0;
+    struct control *controls = game->controls;
+    unsigned char const *scores;
+    int stale, die, i;
+
+    stale = 0;
+    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
+	if (!ismodified(controls[i]))
+	    continue;
+	die = controls[i].value;
+	if (die == game->currentdice[i - ctl_dice])
+	    continue;
+	stale |= slotbit(ctl_slot_ones + die)
+	       | slotbit(ctl_slot_ones + game->currentdice[i - ctl_dice]);
+	handremovedie(game->currenthand, game->currentdice[i - ctl_dice]);
+	handadddie(game->currenthand, die);
+	game->currentdice[i - ctl_dice] = die;
+    }
+    if (stale)
+	stale |= lowerslotsmask;
+
+    scores = handscores[handindex(game->currenthand)];
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	if (!isdisabled(controls[i]) &&
+			((stale & slotbit(i)) || controls[i].value < 0))
+	    controls[i].value = scores[i - ctl_slots];
 }
 
-/*
- * Exported functions.
+/* Forget all of the used slots, at the start of a new game. The
+ * current hand is reset to five ones, so every die that is rolled
+ * will be compared against that.
  */
+void resetscores(struct game *game)
+{
+    int i;
+
+    game->currenthand = 0;
+    for (i = 0 ; i < ctl_dice_count ; ++i) {
+	game->currentdice[i] = 0;
+	handadddie(game->currenthand, 0);
+    }
+    game->uppertotal = game->lowertotal = 0;
+    game->upperusedcount = game->lowerusedcount = 0;
+    game->selectedslot = -1;
+}
 
-/* Initialize the slotevalfunctions array.
+/* Note that a slot has been selected.
  */
-void initscoring(void)
+void markslotselected(struct game *game, int slot)
 {
-    slotevalfunctions[ctl_slot_ones] = ones;
-    slotevalfunctions[ctl_slot_twos] = twos;
-    slotevalfunctions[ctl_slot_threes] = threes;
-    slotevalfunctions[ctl_slot_fours] = fours;
-    slotevalfunctions[ctl_slot_fives] = fives;
-    slotevalfunctions[ctl_slot_sixes] = sixes;
-    slotevalfunctions[ctl_slot_threeofakind] = threeofakind;
-    slotevalfunctions[ctl_slot_fourofakind] = fourofakind;
-    slotevalfunctions[ctl_slot_fullhouse] = fullhouse;
-    slotevalfunctions[ctl_slot_smallstraight] = smallstraight;
-    slotevalfunctions[ctl_slot_largestraight] = largestraight;
-    slotevalfunctions[ctl_slot_yahtzee] = yahtzee;
-    slotevalfunctions[ctl_slot_chance] = chance;
+    game->selectedslot = slot;
 }
 
-/* Compute the score for each open slot using the current dice.
+/* Note that a slot is no longer selected.
  */
-void updateopenslots(void)
+void markslotunselected(struct game *game, int slot)
 {
-    int values[6] = { 0, 0, 0, 0, 0, 0 };
-    int i;
+    if (game->selectedslot == slot)
+	game->selectedslot = -1;
+}
 
-    for (i = ctl_dice ; i < ctl_dice_end ; ++i)
-	++values[controls[i].value];
-    for (i = ctl_slots ; i < ctl_slots_end ; ++i)
-	if (!isdisabled(controls[i]))
-	    controls[i].value = slotevalfunctions[i](values);
+/* Add a slot's score to the running totals once the slot is used.
+ */
+void markslotused(struct game *game, int slot)
+{
+    if (slot <= ctl_slot_sixes) {
+	game->uppertotal += game->controls[slot].value;
+	++game->upperusedcount;
+    } else {
+	game->lowertotal += game->controls[slot].value;
+	++game->lowerusedcount;
+    }
+    markslotunselected(game, slot);
 }
 
 /* Update the values for the output-only scoring slots (subtotal,
- * total, and bonus).
+ * total, and bonus) from the running totals and the selected slot.
  */
-void updatescores(void)
+void updatescores(struct game *game)
 {
-    int total, setcount, i;
-
-    total = 0;
-    setcount = 0;
-    for (i = ctl_slot_ones ; i <= ctl_slot_sixes ; ++i) {
-	if (isdisabled(controls[i]) || isselected(controls[i])) {
-	    ++setcount;
-	    total += controls[i].value;
+    struct control *controls = game->controls;
+    int upper, lower, uppercount, lowercount;
+
+    upper = game->uppertotal;
+    lower = game->lowertotal;
+    uppercount = game->upperusedcount;
+    lowercount = game->lowerusedcount;
+    if (game->selectedslot >= 0) {
+	if (game->selectedslot <= ctl_slot_sixes) {
+	    upper += controls[game->selectedslot].value;
+	    ++uppercount;
+	} else {
+	    lower += controls[game->selectedslot].value;
+	    ++lowercount;
 	}
     }
-    if (setcount) {
-	controls[ctl_slot_subtotal].value = total;
-	if (total >= 63) {
+
+    if (uppercount) {
+	controls[ctl_slot_subtotal].value = upper;
+	if (upper >= 63) {
 	    controls[ctl_slot_bonus].value = 35;
-	    total += 35;
+	    upper += 35;
 	} else {
-	    controls[ctl_slot_bonus].value = setcount == 6 ? 0 : -1;
+	    controls[ctl_slot_bonus].value = uppercount == 6 ? 0 : -1;
 	}
     } else {
 	controls[ctl_slot_subtotal].value = -1;
 	controls[ctl_slot_bonus].value = -1;
     }
-    for (i = ctl_slot_threeofakind ; i <= ctl_slot_chance ; ++i) {
-	if (isdisabled(controls[i]) || isselected(controls[i])) {
-	    ++setcount;
-	    total += controls[i].value;
-	}
-    }
-    controls[ctl_slot_total].value = setcount ? total : -1;
+    controls[ctl_slot_total].value =
+			uppercount + lowercount ? upper + lower : -1;
 }
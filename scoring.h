@@ -7,16 +7,47 @@
 #ifndef _scoring_h_
 #define _scoring_h_
 
-/* Set up the scoring functions.
+/* The list of available implementations of scorehands().
+ */
+enum { scoring_scalar, scoring_sse2, scoring_avx2, scoring_count };
+
+/* Select the fastest implementation of scorehands() that the CPU
+ * supports.
  */
 extern void initscoring(void);
 
-/* Compute the score for each open slot using the current dice.
+/* Select a specific implementation of scorehands(). Returns false if
+ * the implementation is not available on this machine.
+ */
+extern int selectscoring(int method);
+
+/* Compute the score for each open slot using the game's current dice.
+ */
+extern void updateopenslots(struct game *game);
+
+/* Compute the score of every slot for count hands. Each hand is an
+ * array of five die values, 0 through 5. Each hand's scores are
+ * stored in the same order as the slot controls, with zero stored
+ * for the output-only slots.
+ */
+extern void (*scorehands)(unsigned char const (*hands)[ctl_dice_count],
+			  unsigned char (*scores)[ctl_slots_count],
+			  int count);
+
+/* Clear the running totals and the current hand at the start of a
+ * game.
+ */
+extern void resetscores(struct game *game);
+
+/* Keep the running totals up to date as slots are selected,
+ * unselected, and used (i.e., disabled after being scored).
  */
-extern void updateopenslots(void);
+extern void markslotselected(struct game *game, int slot);
+extern void markslotunselected(struct game *game, int slot);
+extern void markslotused(struct game *game, int slot);
 
 /* Update the values for the output-only scoring slots.
  */
-extern void updatescores(void);
+extern void updatescores(struct game *game);
 
 #endif
@@ -195,6 +195,7 @@ int runhelp(void)
     static char const *helptext[] = {
 	"Press Ctrl-+ and Ctrl-\xE2\x80\x93 to resize the window.",
 	"Press ? or F1 to view this help text again.",
+	"Press ! to see what the optimal strategy would do.",
 	"Press Ctrl-K to view the keyboard shortcuts.",
 	"Press Ctrl-V to view the version and license information.",
 	"Press Ctrl-X to exit the program.",
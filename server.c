@@ -0,0 +1,510 @@
+/* server.c: Playing games over a socket.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#define _GNU_SOURCE		/* for accept4() */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "rng.h"
+#include "solver.h"
+#include "solution.h"
+#include "advisor.h"
+#include "engine.h"
+#include "position.h"
+#include "server.h"
+
+/* The size of each session's input and output buffers. A command
+ * line longer than the input buffer ends the session.
+ */
+#define	sessionbufsize		512
+
+/* The longest answer to a single command.
+ */
+#define	maxanswersize		96
+
+/* The number of events to collect from epoll at once.
+ */
+#define	maxevents		64
+
+/* The state of a client's connection. A session belongs to a single
+ * worker for as long as it lasts, so no locking is needed.
+ */
+struct session {
+    int			fd;		/* the client's socket */
+    int			events;		/* the events being waited for */
+    int			quitting;	/* true once quit is received */
+    int			inlen;		/* the bytes waiting in the input */
+    int			outlen;		/* the bytes waiting in the output */
+    struct game		game;		/* the session's game */
+    struct rng		rng;		/* the session's dice */
+    char		in[sessionbufsize];
+    char		out[sessionbufsize];
+};
+
+/* A worker thread, which waits for input from its own set of
+ * sessions.
+ */
+struct worker {
+    pthread_t		thread;		/* the worker's thread */
+    int			epollfd;	/* the worker's epoll instance */
+};
+
+/*
+ * The commands.
+ */
+
+/* Find the slot with the given hotkey.
+ */
+static int findslot(struct game const *game, char const *key)
+{
+    int i;
+
+    if (!key[0] || key[1])
+	return -1;
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i)
+	if (game->controls[i].key && game->controls[i].key == key[0])
+	    return i;
+    return -1;
+}
+
+/* Write the state of the game as an answer.
+ */
+static int formatstate(struct game const *game, char *answer)
+{
+    char dice[ctl_dice_count + 1];
+    char open[ctl_slots_count + 1];
+    position pos;
+    int slot, n, i;
+
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	dice[i] = '1' + game->controls[ctl_dice + i].value;
+    dice[i] = '\0';
+    n = 0;
+    slot = '-';
+    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
+	if (!game->controls[i].key)
+	    continue;
+	if (!isdisabled(game->controls[i]))
+	    open[n++] = game->controls[i].key;
+	if (isselected(game->controls[i]))
+	    slot = game->controls[i].key;
+    }
+    if (!n)
+	open[n++] = '-';
+    open[n] = '\0';
+    pos = packposition(game);
+    return sprintf(answer, "ok %s %s %d %c %d %s %016llx\n",
+		   isgameover(game) ? "over" : "play", dice, game->rollcount,
+		   slot, positionscore(pos), open, pos);
+}
+
+/* Reroll exactly the named dice, by selecting them and pushing the
+ * button.
+ */
+static char const *rollcommand(struct game *game, char const *arg)
+{
+    int rerolls, selected, i;
+
+    if (isgameover(game))
+	return "the game is over";
+    if (game->rollcount == 3)
+	return "no rolls left this turn";
+    rerolls = 0;
+    for ( ; *arg ; ++arg) {
+	if (*arg < 'a' || *arg >= 'a' + ctl_dice_count)
+	    return "dice are named a to e";
+	rerolls |= 1 << (*arg - 'a');
+    }
+    if (!rerolls)
+	return "no dice to roll";
+    for (i = 0 ; i < ctl_dice_count ; ++i) {
+	selected = isselected(game->controls[ctl_dice + i]) ? 1 : 0;
+	if (selected != ((rerolls >> i) & 1))
+	    step(game, ctl_dice + i);
+    }
+    step(game, ctl_button);
+    return NULL;
+}
+
+/* Select a slot, unless it is already selected.
+ */
+static char const *choosecommand(struct game *game, char const *arg)
+{
+    int slot;
+
+    if (isgameover(game))
+	return "the game is over";
+    slot = findslot(game, arg);
+    if (slot < 0)
+	return "no such slot";
+    if (isdisabled(game->controls[slot]))
+	return "slot already used";
+    if (!isselected(game->controls[slot]))
+	step(game, slot);
+    return NULL;
+}
+
+/* Score the selected slot, or start a new game.
+ */
+static char const *confirmcommand(struct game *game)
+{
+    if (!isgameover(game)
+		&& (game->controls[ctl_button].value != bval_score
+			|| isdisabled(game->controls[ctl_button])))
+	return "no slot selected";
+    step(game, ctl_button);
+    return NULL;
+}
+
+/* Describe the advice as a command. The advice is only available
+ * from a loaded solution, since the lazy solver cannot be shared
+ * between threads.
+ */
+static char const *hintcommand(struct game const *game, char *answer)
+{
+    int ctl, rerolls, n, i;
+
+    if (!solution)
+	return "no solution loaded";
+    ctl = getadvice(game, &rerolls);
+    if (ctl < 0)
+	return "the game is over";
+    if (ctl != ctl_button) {
+	sprintf(answer, "hint choose %c\n", game->controls[ctl].key);
+	return NULL;
+    }
+    n = sprintf(answer, "hint roll ");
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	if (rerolls & (1 << i))
+	    answer[n++] = 'a' + i;
+    answer[n++] = '\n';
+    answer[n] = '\0';
+    return NULL;
+}
+
+/* Carry out one command line, and write the answer.
+ */
+static void runcommand(struct session *session, char *line)
+{
+    char *answer = session->out + session->outlen;
+    char const *error;
+    char *arg;
+
+    arg = strchr(line, ' ');
+    if (arg)
+	*arg++ = '\0';
+    else
+	arg = line + strlen(line);
+    error = NULL;
+    *answer = '\0';
+    if (!strcmp(line, "roll"))
+	error = rollcommand(&session->game, arg);
+    else if (!strcmp(line, "choose"))
+	error = choosecommand(&session->game, arg);
+    else if (!strcmp(line, "confirm") && !*arg)
+	error = confirmcommand(&session->game);
+    else if (!strcmp(line, "hint") && !*arg)
+	error = hintcommand(&session->game, answer);
+    else if (!strcmp(line, "state") && !*arg)
+	error = NULL;
+    else if (!strcmp(line, "quit") && !*arg)
+	session->quitting = 1;
+    else
+	error = "unknown command";
+
+    if (error)
+	session->outlen += sprintf(answer, "error %s\n", error);
+    else if (session->quitting)
+	session->outlen += sprintf(answer, "bye\n");
+    else if (*answer)
+	session->outlen += strlen(answer);
+    else
+	session->outlen += formatstate(&session->game, answer);
+}
+
+/*
+ * Managing the sessions.
+ */
+
+/* Carry out each complete line of input, as long as there is room
+ * for the answers. Returns false if the input buffer is full without
+ * holding a complete line.
+ */
+static int runcommands(struct session *session)
+{
+    char *line, *end;
+    int n;
+
+    line = session->in;
+    while (!session->quitting
+		&& session->outlen + maxanswersize <= sessionbufsize) {
+	end = memchr(line, '\n', session->in + session->inlen - line);
+	if (!end)
+	    break;
+	*end = '\0';
+	if (end > line && end[-1] == '\r')
+	    end[-1] = '\0';
+	runcommand(session, line);
+	line = end + 1;
+    }
+    n = session->in + session->inlen - line;
+    memmove(session->in, line, n);
+    session->inlen = n;
+    return n < sessionbufsize || memchr(session->in, '\n', n);
+}
+
+/* Send as much of the pending output as the socket will take.
+ * Returns false if the connection has failed.
+ */
+static int flushoutput(struct session *session)
+{
+    ssize_t n;
+
+    while (session->outlen) {
+	n = send(session->fd, session->out, session->outlen, MSG_NOSIGNAL);
+	if (n < 0) {
+	    if (errno == EINTR)
+		continue;
+	    return errno == EAGAIN || errno == EWOULDBLOCK;
+	}
+	session->outlen -= n;
+	memmove(session->out, session->out + n, session->outlen);
+    }
+    return 1;
+}
+
+/* Wait for input while there is no output pending, and for the
+ * socket to drain while there is. A session stops reading while the
+ * client is not reading its answers.
+ */
+static void updateevents(struct worker *worker, struct session *session)
+{
+    struct epoll_event event;
+    int events;
+
+    events = session->outlen ? EPOLLOUT : EPOLLIN;
+    if (events == session->events)
+	return;
+    session->events = events;
+    event.events = events;
+    event.data.ptr = session;
+    epoll_ctl(worker->epollfd, EPOLL_CTL_MOD, session->fd, &event);
+}
+
+/* Close the connection and free the session.
+ */
+static void endsession(struct worker *worker, struct session *session)
+{
+    epoll_ctl(worker->epollfd, EPOLL_CTL_DEL, session->fd, NULL);
+    close(session->fd);
+    free(session);
+}
+
+/* Handle the socket becoming readable or writable, and carry out
+ * commands until the input runs out or the client falls behind on
+ * reading the answers. Returns false if the session is over.
+ */
+static int servicesession(struct session *session, int events)
+{
+    ssize_t n;
+
+    if (events & EPOLLERR)
+	return 0;
+    if ((events & (EPOLLIN | EPOLLHUP)) && session->inlen < sessionbufsize) {
+	n = recv(session->fd, session->in + session->inlen,
+		 sessionbufsize - session->inlen, 0);
+	if (n == 0)
+	    return 0;
+	if (n > 0)
+	    session->inlen += n;
+	else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+	    return 0;
+    }
+    for (;;) {
+	if (!flushoutput(session) || !runcommands(session)
+				  || !flushoutput(session))
+	    return 0;
+	if (session->outlen || session->quitting
+			    || !memchr(session->in, '\n', session->inlen))
+	    break;
+    }
+    return !(session->quitting && !session->outlen);
+}
+
+/* Wait for events on the worker's sessions and handle them.
+ */
+static void *workerthread(void *data)
+{
+    struct worker *worker = data;
+    struct epoll_event events[maxevents];
+    struct session *session;
+    int count, i;
+
+    for (;;) {
+	count = epoll_wait(worker->epollfd, events, maxevents, -1);
+	if (count < 0) {
+	    if (errno == EINTR)
+		continue;
+	    croak("epoll_wait: %s", strerror(errno));
+	}
+	for (i = 0 ; i < count ; ++i) {
+	    session = events[i].data.ptr;
+	    if (servicesession(session, events[i].events))
+		updateevents(worker, session);
+	    else
+		endsession(worker, session);
+	}
+    }
+    return NULL;
+}
+
+/* Set up a session for a new connection, start its game, and hand it
+ * to a worker. The session's dice are seeded from the next number of
+ * the server's generator, as rngbatchseed() seeds its lanes, so the
+ * cost does not grow with the number of sessions. The first answer is
+ * the state of the game.
+ */
+static void startsession(struct worker *worker, int fd, struct rng *seeds)
+{
+    struct epoll_event event;
+    struct session *session;
+
+    session = allocate(sizeof *session);
+    session->fd = fd;
+    session->quitting = 0;
+    session->inlen = 0;
+    rngseed(&session->rng, rngnext(seeds), 0);
+    session->game.rng = &session->rng;
+    initcontrols(&session->game);
+    startgame(&session->game);
+    session->outlen = formatstate(&session->game, session->out);
+    flushoutput(session);
+
+    session->events = session->outlen ? EPOLLOUT : EPOLLIN;
+    event.events = session->events;
+    event.data.ptr = session;
+    if (epoll_ctl(worker->epollfd, EPOLL_CTL_ADD, fd, &event)) {
+	close(fd);
+	free(session);
+    }
+}
+
+/* Create the listening socket, replacing any socket that was left
+ * at the path by an earlier server that is no longer running. A
+ * socket that still accepts connections is left alone, and the
+ * server fails with EADDRINUSE. Returns -1 on failure.
+ */
+static int opensocket(char const *path)
+{
+    struct sockaddr_un addr;
+    struct stat st;
+    int fd, n;
+
+    if (strlen(path) >= sizeof addr.sun_path) {
+	errno = ENAMETOOLONG;
+	return -1;
+    }
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    if (!stat(path, &st) && S_ISSOCK(st.st_mode)) {
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	    return -1;
+	n = connect(fd, (struct sockaddr*)&addr, sizeof addr) ? errno : 0;
+	close(fd);
+	if (!n) {
+	    errno = EADDRINUSE;
+	    return -1;
+	}
+	if (n == ECONNREFUSED)
+	    unlink(path);
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+	return -1;
+    if (bind(fd, (struct sockaddr*)&addr, sizeof addr) || listen(fd, 1024)) {
+	close(fd);
+	return -1;
+    }
+    return fd;
+}
+
+/*
+ * Exported functions.
+ */
+
+/* Start the workers, and then accept connections and deal them out
+ * to the workers in turn.
+ */
+int runserver(char const *path, int threadcount, unsigned long long seed)
+{
+    struct epoll_event event;
+    struct worker *workers;
+    struct rng seeds;
+    int epollfd, listenfd, fd, next, i;
+
+    listenfd = opensocket(path);
+    if (listenfd < 0) {
+	perror(path);
+	return EXIT_FAILURE;
+    }
+
+    /* Build the solver's tables now rather than during the first
+     * hint, so that no client waits for them.
+     */
+    if (solution)
+	initsolver();
+
+    workers = allocate(threadcount * sizeof *workers);
+    for (i = 0 ; i < threadcount ; ++i) {
+	workers[i].epollfd = epoll_create1(EPOLL_CLOEXEC);
+	if (workers[i].epollfd < 0)
+	    croak("epoll_create1: %s", strerror(errno));
+	if (pthread_create(&workers[i].thread, NULL, workerthread,
+			   &workers[i]))
+	    croak("cannot create server thread %d", i);
+    }
+
+    epollfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollfd < 0)
+	croak("epoll_create1: %s", strerror(errno));
+    event.events = EPOLLIN;
+    event.data.fd = listenfd;
+    epoll_ctl(epollfd, EPOLL_CTL_ADD, listenfd, &event);
+    printf("Serving games on %s using %d thread%s (seed %llu)\n",
+	   path, threadcount, threadcount == 1 ? "" : "s", seed);
+    fflush(stdout);
+
+    rngseed(&seeds, seed, 0);
+    next = 0;
+    for (;;) {
+	if (epoll_wait(epollfd, &event, 1, -1) < 0) {
+	    if (errno == EINTR)
+		continue;
+	    croak("epoll_wait: %s", strerror(errno));
+	}
+	for (;;) {
+	    fd = accept4(listenfd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+	    if (fd < 0)
+		break;
+	    startsession(&workers[next], fd, &seeds);
+	    next = (next + 1) % threadcount;
+	}
+	if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR
+			    && errno != ECONNABORTED)
+	    perror("accept");
+    }
+}
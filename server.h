@@ -0,0 +1,49 @@
+/* server.h: Playing games over a socket.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _server_h_
+#define _server_h_
+
+/* The server plays a separate game with each client that connects to
+ * a Unix domain socket. The protocol is made of lines of text. The
+ * client sends one command per line, and the server answers each
+ * command with one line. The commands are:
+ *
+ * roll DICE   reroll the dice named by the letters a to e
+ * choose KEY  select the open slot with the given hotkey
+ * confirm     score the dice in the selected slot, or start another
+ *             game once the game is over
+ * hint        ask for the move that optimal play would make
+ * state       ask for the state of the game
+ * quit        end the session
+ *
+ * When a command succeeds, the answer is the state of the game in
+ * the form
+ *
+ * ok STATUS DICE ROLLS SLOT SCORE OPEN POSITION
+ *
+ * where STATUS is "play" or "over", DICE is the five dice as the
+ * digits 1 to 6, ROLLS is the number of times the dice have been
+ * rolled this turn, SLOT is the hotkey of the selected slot or "-",
+ * SCORE is the total score so far, OPEN is the hotkeys of the open
+ * slots or "-", and POSITION is the game's packed position (see
+ * position.h) in hexadecimal. The same line is sent when a client
+ * first connects. A failed command leaves the game unchanged, and
+ * is answered with "error" followed by a message. A hint is answered
+ * with "hint" followed by the command to make, such as "roll ab" or
+ * "choose y", and quit is answered with "bye".
+ */
+
+/* Play games with clients that connect to the socket at the given
+ * path, handling them with threadcount worker threads. Each client's
+ * dice are seeded from a generator determined by the seed, in the
+ * order in which the clients connected. Returns only if the socket
+ * cannot be opened.
+ */
+extern int runserver(char const *path, int threadcount,
+		     unsigned long long seed);
+
+#endif
@@ -0,0 +1,510 @@
+/* simulate.c: Playing many games without a user interface.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "rng.h"
+#include "hand.h"
+#include "tables.h"
+#include "solver.h"
+#include "distribution.h"
+#include "policy.h"
+#include "simulate.h"
+
+/* The largest number of threads that simulate() will use.
+ */
+#define	maxthreads		256
+
+/* The number of games that each thread plays at once, and how often,
+ * in seconds, the progress is displayed.
+ */
+#define	gamebatchsize		64
+#define	progressinterval	1.0
+
+/* The number of dice that each thread rolls at once.
+ */
+#define	dicebuffersize		4096
+
+/* A supply of dice, rolled in bulk and used up a few at a time.
+ */
+struct dicebuffer {
+    struct rngbatch rng;		/* the generator for the dice */
+    int next;				/* the next unused die */
+    unsigned char dice[dicebuffersize];	/* the dice rolled so far */
+};
+
+/* The dice for one game, dealt out in advance: the faces for each
+ * roll of each turn, in the order that the rolled dice use them.
+ */
+typedef unsigned char gamerolls[category_count][3][ctl_dice_count];
+
+/* A thread playing its share of the games.
+ */
+struct simthread {
+    struct policy const *const *policies; /* the policies to play with */
+    unsigned long long games;		/* the number of games to play */
+    unsigned long long seed;		/* the seed for the players */
+    struct dicebuffer dice;		/* the dice */
+    struct simcomparison results;	/* the results */
+    unsigned long long done;		/* the games finished so far */
+    pthread_t thread;			/* the thread */
+};
+
+/* Return the current time in seconds.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Add one game's result to the sums in a set of statistics.
+ */
+static void addsums(struct simstats *stats, int score)
+{
+    if (!stats->games || stats->lowest > score)
+	stats->lowest = score;
+    if (!stats->games || stats->highest < score)
+	stats->highest = score;
+    ++stats->games;
+    stats->sum += score;
+    stats->sumsquares += (double)score * score;
+}
+
+/* Add one set of statistics to another.
+ */
+static void addstats(struct simstats *stats, struct simstats const *more)
+{
+    int i;
+
+    if (!more->games)
+	return;
+    if (!stats->games || stats->lowest > more->lowest)
+	stats->lowest = more->lowest;
+    if (!stats->games || stats->highest < more->highest)
+	stats->highest = more->highest;
+    stats->games += more->games;
+    stats->sum += more->sum;
+    stats->sumsquares += more->sumsquares;
+    stats->playtime += more->playtime;
+    stats->decisions += more->decisions;
+    stats->bonuses += more->bonuses;
+    stats->yahtzees += more->yahtzees;
+    for (i = 0 ; i < ctl_slots_count ; ++i)
+	stats->slottotals[i] += more->slottotals[i];
+    for (i = 0 ; i <= maxscore ; ++i)
+	stats->scorecounts[i] += more->scorecounts[i];
+}
+
+/* Deal out the dice for the next game.
+ */
+static void dealgame(struct dicebuffer *buffer, gamerolls rolls)
+{
+    unsigned char *dest;
+    int count, n;
+
+    dest = &rolls[0][0][0];
+    count = sizeof(gamerolls);
+    while (count) {
+	if (buffer->next == dicebuffersize) {
+	    rngfill(&buffer->rng, buffer->dice, dicebuffersize);
+	    buffer->next = 0;
+	}
+	n = dicebuffersize - buffer->next;
+	if (n > count)
+	    n = count;
+	memcpy(dest, buffer->dice + buffer->next, n);
+	buffer->next += n;
+	dest += n;
+	count -= n;
+    }
+}
+
+/* Roll the dice that are not in the keep mask, using the faces in
+ * order.
+ */
+static void rolldice(unsigned char *dice, int keepmask,
+		     unsigned char const *faces)
+{
+    int i;
+
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	if (!(keepmask & (1 << i)))
+	    dice[i] = *faces++;
+}
+
+/* Ask the policy to choose keeps for the games that are still
+ * rolling. The states are gathered together for a policy that can
+ * make its choices in a batch.
+ */
+static void choosekeeps(struct policy const *policy, void *player,
+			struct turnstate const *states, int const *active,
+			int *keepmasks, int count)
+{
+    struct turnstate batch[gamebatchsize];
+    int i;
+
+    if (policy->choosekeeps) {
+	for (i = 0 ; i < count ; ++i)
+	    batch[i] = states[active[i]];
+	policy->choosekeeps(player, batch, keepmasks, count);
+    } else {
+	for (i = 0 ; i < count ; ++i)
+	    keepmasks[i] = policy->choosekeep(player, states + active[i]);
+    }
+}
+
+/* Ask the policy to choose categories for every game.
+ */
+static void choosecategories(struct policy const *policy, void *player,
+			     struct turnstate const *states, int *categories,
+			     int count)
+{
+    int i;
+
+    if (policy->choosecategories)
+	policy->choosecategories(player, states, categories, count);
+    else
+	for (i = 0 ; i < count ; ++i)
+	    categories[i] = policy->choosecategory(player, states + i);
+}
+
+/* Score the dice of a game in a category, and add the points to the
+ * statistics. The bonus is added as soon as the upper section
+ * reaches 63 points.
+ */
+static void scoreturn(struct policy const *policy, struct turnstate *state,
+		      int *upper, int c, struct simstats *stats)
+{
+    int points;
+
+    if (c < 0 || c >= category_count || (state->mask & (1 << c)))
+	croak("policy %s chose an invalid category", policy->name);
+    points = handscores[sortdice(state->dice, NULL)]
+		       [categoryslots[c] - ctl_slots];
+    stats->slottotals[categoryslots[c] - ctl_slots] += points;
+    if (categoryslots[c] == ctl_slot_yahtzee && points)
+	++stats->yahtzees;
+    state->score += points;
+    state->mask |= 1 << c;
+    if (c < 6) {
+	if (*upper < 63 && *upper + points >= 63)
+	    state->score += 35;
+	*upper += points;
+	state->subtotal = *upper < 63 ? *upper : 63;
+    }
+}
+
+/* Play a batch of complete games with the dealt dice, add the results
+ * to the statistics, and store the final scores. The games are played
+ * in step, so that the policy makes each choice for all of them
+ * together. Each turn, the dice are rolled and then rerolled as the
+ * policy chooses, up to two times; a game drops out of the rerolling
+ * once the policy keeps all five dice. Then the dice are scored in
+ * the category that the policy chooses.
+ */
+static void playgames(struct policy const *policy, void *player,
+		      gamerolls *rolls, int count,
+		      struct simstats *stats, int *scores)
+{
+    struct turnstate states[gamebatchsize];
+    int upper[gamebatchsize];
+    int active[gamebatchsize];
+    int choices[gamebatchsize];
+    int turn, rerolls, activecount, g, i, n;
+
+    for (g = 0 ; g < count ; ++g) {
+	states[g].mask = 0;
+	states[g].subtotal = 0;
+	states[g].score = 0;
+	upper[g] = 0;
+    }
+    for (turn = 0 ; turn < category_count ; ++turn) {
+	for (g = 0 ; g < count ; ++g) {
+	    rolldice(states[g].dice, 0, rolls[g][turn][0]);
+	    states[g].rerolls = 2;
+	    active[g] = g;
+	}
+	activecount = count;
+	for (rerolls = 2 ; rerolls > 0 && activecount ; --rerolls) {
+	    choosekeeps(policy, player, states, active, choices, activecount);
+	    stats->decisions += activecount;
+	    n = 0;
+	    for (i = 0 ; i < activecount ; ++i) {
+		if (choices[i] == (1 << ctl_dice_count) - 1)
+		    continue;
+		g = active[i];
+		rolldice(states[g].dice, choices[i],
+			 rolls[g][turn][3 - rerolls]);
+		states[g].rerolls = rerolls - 1;
+		active[n++] = g;
+	    }
+	    activecount = n;
+	}
+	choosecategories(policy, player, states, choices, count);
+	stats->decisions += count;
+	for (g = 0 ; g < count ; ++g)
+	    scoreturn(policy, &states[g], &upper[g], choices[g], stats);
+    }
+
+    for (g = 0 ; g < count ; ++g) {
+	stats->slottotals[ctl_slot_subtotal - ctl_slots] += upper[g];
+	if (upper[g] >= 63) {
+	    stats->slottotals[ctl_slot_bonus - ctl_slots] += 35;
+	    ++stats->bonuses;
+	}
+	stats->slottotals[ctl_slot_total - ctl_slots] += states[g].score;
+	addsums(stats, states[g].score);
+	++stats->scorecounts[states[g].score];
+	scores[g] = states[g].score;
+    }
+}
+
+/* The body of a simulation thread. When there are several policies,
+ * they all play each game with the same dice. The games are dealt in
+ * batches, and a policy that can make choices in batches plays the
+ * whole batch in step; other policies play one game at a time, since
+ * keeping many games in step only slows them down. The statistics
+ * belong to the thread alone, and only the count of finished games is
+ * shared, after each batch.
+ */
+static void *simthread(void *data)
+{
+    struct simthread *sim = data;
+    struct simcomparison *results = &sim->results;
+    struct policy const *policy;
+    void *players[maxpolicies];
+    int scores[maxpolicies][gamebatchsize];
+    gamerolls rolls[gamebatchsize];
+    unsigned long long n;
+    double t;
+    int count, step, g, i, j;
+
+    for (i = 0 ; i < results->count ; ++i) {
+	policy = sim->policies[i];
+	players[i] = policy->newplayer ? policy->newplayer(policy, sim->seed)
+				       : NULL;
+    }
+    for (n = 0 ; n < sim->games ; n += count) {
+	count = sim->games - n < gamebatchsize ? sim->games - n
+					       : gamebatchsize;
+	for (g = 0 ; g < count ; ++g)
+	    dealgame(&sim->dice, rolls[g]);
+	for (i = 0 ; i < results->count ; ++i) {
+	    policy = sim->policies[i];
+	    step = policy->choosekeeps || policy->choosecategories ? count : 1;
+	    t = now();
+	    for (g = 0 ; g < count ; g += step)
+		playgames(policy, players[i], rolls + g, step,
+			  &results->stats[i], scores[i] + g);
+	    results->stats[i].playtime += now() - t;
+	}
+	for (g = 0 ; g < count ; ++g) {
+	    for (i = 0 ; i < results->count ; ++i) {
+		for (j = 0 ; j < results->count ; ++j) {
+		    results->diffsums[i][j] += scores[i][g] - scores[j][g];
+		    results->diffsquares[i][j] +=
+				(double)(scores[i][g] - scores[j][g])
+					* (scores[i][g] - scores[j][g]);
+		    if (scores[i][g] > scores[j][g])
+			++results->wins[i][j];
+		}
+	    }
+	}
+	__atomic_store_n(&sim->done, n + count, __ATOMIC_RELAXED);
+    }
+    for (i = 0 ; i < results->count ; ++i)
+	if (sim->policies[i]->freeplayer)
+	    sim->policies[i]->freeplayer(players[i]);
+    return NULL;
+}
+
+/* Display the number of games finished, the rate, and the estimated
+ * time remaining, until every thread is done.
+ */
+static void showprogress(struct simthread const *threads, int threadcount,
+			 unsigned long long games, double start, FILE *log)
+{
+    struct timespec pause;
+    unsigned long long done;
+    double elapsed, shown;
+    int i;
+
+    pause.tv_sec = 0;
+    pause.tv_nsec = 50000000;
+    shown = start;
+    for (;;) {
+	nanosleep(&pause, NULL);
+	done = 0;
+	for (i = 0 ; i < threadcount ; ++i)
+	    done += __atomic_load_n(&threads[i].done, __ATOMIC_RELAXED);
+	if (done >= games)
+	    break;
+	if (now() - shown < progressinterval)
+	    continue;
+	shown = now();
+	elapsed = shown - start;
+	fprintf(log, "\r%llu of %llu games (%.1f%%), %.0f per second,"
+		     " %.0f sec left ",
+		done, games, 100.0 * done / games, done / elapsed,
+		done ? (games - done) * elapsed / done : 0.0);
+	fflush(log);
+    }
+    if (shown > start)
+	fprintf(log, "\r%70s\r", "");
+}
+
+/* Divide the games evenly among the threads, and combine their
+ * results when they are all done. Each thread gets its own stream
+ * from the seed, so the dice depend only on the seed and the number
+ * of threads, and not on the policies.
+ */
+static void runthreads(struct policy const *const *policies, int count,
+		       unsigned long long games, int threadcount,
+		       unsigned long long seed,
+		       struct simcomparison *results, FILE *log)
+{
+    struct simthread *threads;
+    struct simcomparison *more;
+    struct rng rng;
+    double start;
+    int i, j, k;
+
+    if (count < 1 || count > maxpolicies)
+	croak("cannot simulate %d policies at once", count);
+    if (threadcount < 1)
+	threadcount = 1;
+    if (threadcount > maxthreads)
+	threadcount = maxthreads;
+    threads = allocate(threadcount * sizeof *threads);
+    start = now();
+    for (i = 0 ; i < threadcount ; ++i) {
+	threads[i].policies = policies;
+	threads[i].games = games * (i + 1) / threadcount
+			 - games * i / threadcount;
+	rngseed(&rng, seed, i);
+	threads[i].seed = rngnext(&rng);
+	rngbatchseed(&threads[i].dice.rng, &rng);
+	threads[i].dice.next = dicebuffersize;
+	memset(&threads[i].results, 0, sizeof threads[i].results);
+	threads[i].results.count = count;
+	threads[i].done = 0;
+	if (pthread_create(&threads[i].thread, NULL, simthread, &threads[i]))
+	    croak("cannot create simulation thread %d", i);
+    }
+
+    if (log)
+	showprogress(threads, threadcount, games, start, log);
+    memset(results, 0, sizeof *results);
+    results->count = count;
+    for (i = 0 ; i < threadcount ; ++i) {
+	pthread_join(threads[i].thread, NULL);
+	more = &threads[i].results;
+	for (j = 0 ; j < count ; ++j) {
+	    addstats(&results->stats[j], &more->stats[j]);
+	    for (k = 0 ; k < count ; ++k) {
+		results->diffsums[j][k] += more->diffsums[j][k];
+		results->diffsquares[j][k] += more->diffsquares[j][k];
+		results->wins[j][k] += more->wins[j][k];
+	    }
+	}
+    }
+    for (j = 0 ; j < count ; ++j)
+	results->stats[j].seconds = now() - start;
+    free(threads);
+}
+
+/*
+ * Exported functions.
+ */
+
+/* The mean and variance come from the sums.
+ */
+double simmean(struct simstats const *stats)
+{
+    return stats->games ? stats->sum / stats->games : 0.0;
+}
+
+double simvariance(struct simstats const *stats)
+{
+    double mean, variance;
+
+    if (!stats->games)
+	return 0.0;
+    mean = stats->sum / stats->games;
+    variance = stats->sumsquares / stats->games - mean * mean;
+    return variance > 0.0 ? variance : 0.0;
+}
+
+/* Walk up the counts of each score.
+ */
+int simpercentile(struct simstats const *stats, double fraction)
+{
+    unsigned long long total;
+    int score;
+
+    total = 0;
+    for (score = 0 ; score < maxscore ; ++score) {
+	total += stats->scorecounts[score];
+	if (total && total >= fraction * stats->games)
+	    break;
+    }
+    return score;
+}
+
+/* The mean and variance of a difference come from its sums.
+ */
+double simdiffmean(struct simcomparison const *results, int i, int j)
+{
+    unsigned long long games;
+
+    games = results->stats[i].games;
+    return games ? results->diffsums[i][j] / games : 0.0;
+}
+
+double simdiffvariance(struct simcomparison const *results, int i, int j)
+{
+    unsigned long long games;
+    double mean, variance;
+
+    games = results->stats[i].games;
+    if (!games)
+	return 0.0;
+    mean = results->diffsums[i][j] / games;
+    variance = results->diffsquares[i][j] / games - mean * mean;
+    return variance > 0.0 ? variance : 0.0;
+}
+
+/* Run the games with only one policy.
+ */
+void simulate(struct policy const *policy, unsigned long long games,
+	      int threadcount, unsigned long long seed, struct simstats *stats,
+	      FILE *log)
+{
+    struct simcomparison *results;
+
+    results = allocate(sizeof *results);
+    runthreads(&policy, 1, games, threadcount, seed, results, log);
+    *stats = results->stats[0];
+    free(results);
+}
+
+/* Run the games with every policy.
+ */
+void comparepolicies(struct policy const *const *policies, int count,
+		     unsigned long long games, int threadcount,
+		     unsigned long long seed, struct simcomparison *results,
+		     FILE *log)
+{
+    runthreads(policies, count, games, threadcount, seed, results, log);
+}
@@ -0,0 +1,93 @@
+/* simulate.h: Playing many games without a user interface.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _simulate_h_
+#define _simulate_h_
+
+/* The statistics gathered from a run of simulated games. The slot
+ * totals are in the same order as the slot controls, so they include
+ * the upper subtotal (before it is capped), the bonus and the grand
+ * total.
+ */
+struct simstats {
+    unsigned long long	games;		/* the number of games played */
+    double		sum;		/* the sum of the final scores */
+    double		sumsquares;	/* the sum of their squares */
+    int			lowest;		/* the lowest final score */
+    int			highest;	/* the highest final score */
+    double		seconds;	/* the time taken */
+    double		playtime;	/* the time spent in play, summed
+					   over every thread */
+    unsigned long long	decisions;	/* the choices the policy made */
+    unsigned long long	bonuses;	/* the games that earned the bonus */
+    unsigned long long	yahtzees;	/* the games with a Yahtzee scored */
+    unsigned long long	slottotals[ctl_slots_count]; /* each slot's points */
+    unsigned long long	scorecounts[maxscore + 1]; /* the games with each
+						      final score */
+};
+
+/* Return the mean and the variance of the scores.
+ */
+extern double simmean(struct simstats const *stats);
+extern double simvariance(struct simstats const *stats);
+
+/* Return the lowest final score that at least the given fraction of
+ * the games did not exceed. This is exact, as every score is counted.
+ */
+extern int simpercentile(struct simstats const *stats, double fraction);
+
+/* Play games with a policy, following the same rules as the game
+ * itself, and gather statistics on the final scores. The games are
+ * divided among threadcount threads, each with its own player, its
+ * own stream of dice and its own statistics, which are combined at
+ * the end. The seed determines every die rolled, so a run can be
+ * repeated exactly with the same seed and thread count. If log is not
+ * NULL, the progress so far is displayed on it once a second.
+ */
+extern void simulate(struct policy const *policy, unsigned long long games,
+		     int threadcount, unsigned long long seed,
+		     struct simstats *stats, FILE *log);
+
+/* The most policies that can play against each other at once.
+ */
+#define	maxpolicies		8
+
+/* The results of playing several policies against the same dice. For
+ * each pair of policies i and j, diffsums[i][j] and diffsquares[i][j]
+ * are the sums of policy i's score minus policy j's in each game and
+ * of its square, and wins[i][j] counts the games in which policy i
+ * scored more than policy j.
+ */
+struct simcomparison {
+    int			count;		/* the number of policies */
+    struct simstats	stats[maxpolicies]; /* each policy's scores */
+    double		diffsums[maxpolicies][maxpolicies];
+    double		diffsquares[maxpolicies][maxpolicies];
+    unsigned long long	wins[maxpolicies][maxpolicies];
+};
+
+/* Return the mean and the variance of the difference between two
+ * policies' scores.
+ */
+extern double simdiffmean(struct simcomparison const *results, int i, int j);
+extern double simdiffvariance(struct simcomparison const *results,
+			      int i, int j);
+
+/* Play games with several policies, as simulate() does, except that
+ * every policy plays every game with the same dice. Each game's dice
+ * are dealt out in advance, with five faces for each roll of each
+ * turn, and the dice rolled on a given roll of a turn take those
+ * faces in order. So two policies see the same dice for as long as
+ * they make the same choices, and much the same luck after that,
+ * which makes the difference between their scores far less variable
+ * than it would be with independent dice.
+ */
+extern void comparepolicies(struct policy const *const *policies, int count,
+			    unsigned long long games, int threadcount,
+			    unsigned long long seed,
+			    struct simcomparison *results, FILE *log);
+
+#endif
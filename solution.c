@@ -0,0 +1,360 @@
+/* solution.c: Storing and loading the optimal strategy.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "gen.h"
+#include "solver.h"
+#include "distribution.h"
+#include "target.h"
+#include "solution.h"
+
+/* The identifying strings at the start of a solution file, a
+ * distribution file, and a target file.
+ */
+static char const solutionmagic[8] = "yahtzee";
+static char const distributionmagic[8] = "yahtzeed";
+static char const targetmagic[8] = "yahtzeet";
+
+/* The versions of the file formats. These must be incremented
+ * whenever the layout of the tables, or the values that the solvers
+ * compute, change.
+ */
+#define	solution_version	1
+#define	distribution_version	1
+#define	target_version		1
+
+/* A value stored in the header to detect files that were created
+ * on a machine with a different byte order.
+ */
+#define	solution_byteorder	0x01020304
+
+/* The header of a solution, distribution or target file. The header
+ * is padded out to 64 bytes, so that the table that immediately
+ * follows it is aligned within the mapping. The table may be followed by
+ * extrasize bytes of other data.
+ */
+struct header {
+    char		magic[8];	/* identifies the kind of file */
+    unsigned int	version;	/* the version of the format */
+    unsigned int	byteorder;	/* solution_byteorder */
+    unsigned int	entrysize;	/* size of one table entry */
+    unsigned int	entrycount;	/* number of table entries */
+    unsigned int	checksum;	/* checksum of the table */
+    unsigned int	extrasize;	/* size of the data after the table */
+    unsigned int	reserved[8];	/* set to zero */
+};
+
+/* The loaded tables.
+ */
+float const *solution = NULL;
+struct distributiontable const *distributions = NULL;
+unsigned short const *targets = NULL;
+
+/* The checksum of the data after the header is the 32-bit FNV-1a
+ * hash, applied to whole words rather than bytes. (The size of the
+ * data is always a multiple of four.) This is the starting value.
+ */
+#define	checksum_basis		2166136261U
+
+/* Add a block of data to a checksum.
+ */
+static unsigned int checksum(unsigned int h, void const *data, size_t size)
+{
+    unsigned int const *p = data;
+    size_t n;
+
+    for (n = 0 ; n < size / sizeof *p ; ++n) {
+	h ^= p[n];
+	h *= 16777619U;
+    }
+    return h;
+}
+
+/* Return a default filename, building it the first time: the value
+ * of an environment variable if it is set, and otherwise a file in
+ * the user's home directory.
+ */
+static char const *defaultpath(char **path, char const *variable,
+			       char const *basename)
+{
+    char const *dir;
+
+    dir = getenv(variable);
+    if (dir && *dir)
+	return dir;
+    if (!*path) {
+	dir = getenv("HOME");
+	if (!dir || !*dir)
+	    dir = ".";
+	*path = allocate(strlen(dir) + strlen(basename) + 2);
+	sprintf(*path, "%s/%s", dir, basename);
+    }
+    return *path;
+}
+
+/* Write a header and the data that follows it to a temporary file,
+ * and then rename it over the original.
+ */
+static int savefile(char const *filename, char const *magic,
+		    unsigned int version, unsigned int entrysize,
+		    unsigned int entrycount, void const *table,
+		    void const *extra, unsigned int extrasize)
+{
+    struct header header;
+    FILE *fp;
+    char *tempname;
+    unsigned int tablesize;
+    int n;
+
+    tablesize = entrysize * entrycount;
+    memset(&header, 0, sizeof header);
+    memcpy(header.magic, magic, sizeof header.magic);
+    header.version = version;
+    header.byteorder = solution_byteorder;
+    header.entrysize = entrysize;
+    header.entrycount = entrycount;
+    header.extrasize = extrasize;
+    header.checksum = checksum(checksum(checksum_basis, table, tablesize),
+			       extra, extrasize);
+
+    tempname = allocate(strlen(filename) + 5);
+    sprintf(tempname, "%s.tmp", filename);
+    fp = fopen(tempname, "wb");
+    if (!fp) {
+	free(tempname);
+	return 0;
+    }
+    n = fwrite(&header, sizeof header, 1, fp) == 1
+	&& fwrite(table, 1, tablesize, fp) == tablesize
+	&& fwrite(extra, 1, extrasize, fp) == extrasize;
+    if (fclose(fp) || !n || rename(tempname, filename)) {
+	n = errno;
+	remove(tempname);
+	free(tempname);
+	errno = n;
+	return 0;
+    }
+    free(tempname);
+    return 1;
+}
+
+/* Map a file and verify that the header matches what this program
+ * would have written. The checksum is not verified here, as that
+ * would read every page of the file; see verifyfile(). Returns the
+ * header, or NULL if the file cannot be used. A warning is displayed
+ * unless the file does not exist.
+ */
+static struct header const *mapfile(char const *filename,
+				    char const *magic, char const *kind,
+				    unsigned int version,
+				    unsigned int entrysize,
+				    unsigned int entrycount)
+{
+    struct stat st;
+    struct header const *header;
+    void *map;
+    size_t size;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+	if (errno != ENOENT)
+	    perror(filename);
+	return NULL;
+    }
+    if (fstat(fd, &st) || (size_t)st.st_size < sizeof *header
+		       || (size_t)st.st_size % 4) {
+	close(fd);
+	fprintf(stderr, "%s: not a valid %s file; ignoring\n",
+		filename, kind);
+	return NULL;
+    }
+    size = st.st_size;
+    map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+	perror(filename);
+	return NULL;
+    }
+
+    header = map;
+    if (memcmp(header->magic, magic, sizeof header->magic)
+			|| header->byteorder != solution_byteorder
+			|| header->entrysize != entrysize
+			|| header->entrycount != entrycount
+			|| size != sizeof *header + (size_t)entrysize * entrycount
+						  + header->extrasize) {
+	munmap(map, size);
+	fprintf(stderr, "%s: not a valid %s file; ignoring\n",
+		filename, kind);
+	return NULL;
+    }
+    if (header->version != version) {
+	munmap(map, size);
+	fprintf(stderr, "%s: %s file is out of date; ignoring\n",
+		filename, kind);
+	return NULL;
+    }
+    return header;
+}
+
+/* Map a file and compare its contents against the checksum in its
+ * header, reporting the result. Returns false if the file exists but
+ * is not usable or is corrupted.
+ */
+static int verifyfile(char const *filename, char const *magic,
+		      char const *kind, unsigned int version,
+		      unsigned int entrysize, unsigned int entrycount)
+{
+    struct header const *header;
+    size_t size;
+    int ok;
+
+    if (access(filename, F_OK)) {
+	printf("%s: no %s file\n", filename, kind);
+	return 1;
+    }
+    header = mapfile(filename, magic, kind, version, entrysize, entrycount);
+    if (!header)
+	return 0;
+    size = (size_t)entrysize * entrycount + header->extrasize;
+    ok = header->checksum == checksum(checksum_basis, header + 1, size);
+    if (ok)
+	printf("%s: %s file is intact\n", filename, kind);
+    else
+	fprintf(stderr, "%s: %s file is corrupted\n", filename, kind);
+    munmap((void*)header, sizeof *header + size);
+    return ok;
+}
+
+/*
+ * Exported functions.
+ */
+
+/* Return the default filename of the solution.
+ */
+char const *solutionpath(void)
+{
+    static char *path = NULL;
+
+    return defaultpath(&path, "YAHTZEE_SOLUTION", ".yahtzee-solution");
+}
+
+/* Return the default filename of the distributions.
+ */
+char const *distributionpath(void)
+{
+    static char *path = NULL;
+
+    return defaultpath(&path, "YAHTZEE_DISTRIBUTION",
+		       ".yahtzee-distribution");
+}
+
+/* Return the default filename of the target table.
+ */
+char const *targetpath(void)
+{
+    static char *path = NULL;
+
+    return defaultpath(&path, "YAHTZEE_TARGETS", ".yahtzee-targets");
+}
+
+/* Save the solution table.
+ */
+int savesolution(char const *filename, float const *table)
+{
+    return savefile(filename, solutionmagic, solution_version,
+		    sizeof *table, state_count, table, NULL, 0);
+}
+
+/* Map the solution table.
+ */
+int loadsolution(char const *filename)
+{
+    struct header const *header;
+
+    header = mapfile(filename, solutionmagic, "solution", solution_version,
+		     sizeof *solution, state_count);
+    if (!header)
+	return 0;
+    solution = (float const*)(header + 1);
+    return 1;
+}
+
+/* Save the distribution table, with the cumulative probabilities
+ * following the entries for each state.
+ */
+int savedistributions(char const *filename,
+		      struct distributiontable const *table)
+{
+    return savefile(filename, distributionmagic, distribution_version,
+		    sizeof *table->states, state_count, table->states,
+		    table->cdf, table->cdfcount * sizeof *table->cdf);
+}
+
+/* Map the distribution table.
+ */
+int loaddistributions(char const *filename)
+{
+    static struct distributiontable loaded;
+    struct header const *header;
+
+    header = mapfile(filename, distributionmagic, "distribution",
+		     distribution_version, sizeof *loaded.states,
+		     state_count);
+    if (!header)
+	return 0;
+    loaded.states = (struct scoredistribution const*)(header + 1);
+    loaded.cdf = (unsigned short const*)(loaded.states + state_count);
+    loaded.cdfcount = header->extrasize / sizeof *loaded.cdf;
+    distributions = &loaded;
+    return 1;
+}
+
+/* Save the target table.
+ */
+int savetargets(char const *filename, unsigned short const *table)
+{
+    return savefile(filename, targetmagic, target_version, sizeof *table,
+		    targetentrycount(), table, NULL, 0);
+}
+
+/* Map the target table.
+ */
+int loadtargets(char const *filename)
+{
+    struct header const *header;
+
+    header = mapfile(filename, targetmagic, "target", target_version,
+		     sizeof *targets, targetentrycount());
+    if (!header)
+	return 0;
+    targets = (unsigned short const*)(header + 1);
+    return 1;
+}
+
+/* Verify each of the files in turn.
+ */
+int verifyfiles(void)
+{
+    int ok;
+
+    ok = verifyfile(solutionpath(), solutionmagic, "solution",
+		    solution_version, sizeof *solution, state_count);
+    ok &= verifyfile(distributionpath(), distributionmagic, "distribution",
+		     distribution_version, sizeof(struct scoredistribution),
+		     state_count);
+    ok &= verifyfile(targetpath(), targetmagic, "target", target_version,
+		     sizeof *targets, targetentrycount());
+    return ok;
+}
@@ -0,0 +1,96 @@
+/* solution.h: Storing and loading the optimal strategy.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _solution_h_
+#define _solution_h_
+
+/* The table of expected scores for every turn-start state (as
+ * produced by solvegame()), or NULL if no table has been loaded.
+ * The table is mapped directly from the solution file, so it is
+ * read-only and shared with every other process using the file.
+ */
+extern float const *solution;
+
+/* The expected score of the rest of the game from a turn-start
+ * state, according to the loaded solution.
+ */
+#define	solutionvalue(mask, subtotal)	(solution[stateindex(mask, subtotal)])
+
+/* Return the filename of the solution to use: the value of the
+ * environment variable YAHTZEE_SOLUTION if it is set, otherwise
+ * .yahtzee-solution in the user's home directory.
+ */
+extern char const *solutionpath(void);
+
+/* Write a solution table to a file, along with a header identifying
+ * its format and a checksum of its contents. The file is replaced
+ * atomically, so processes that already have the old file mapped
+ * are not affected. Returns false if an error occurred.
+ */
+extern int savesolution(char const *filename, float const *table);
+
+/* Map a solution file into memory. Returns false if the file does
+ * not exist, or if its header does not match this version of the
+ * program, in which case no solution is loaded. A warning is
+ * displayed if the file exists but cannot be used. The checksum is
+ * not verified, so that loading does not have to read the whole
+ * file; use verifyfiles() for that.
+ */
+extern int loadsolution(char const *filename);
+
+/* The table of score distributions for every turn-start state (as
+ * produced by solvedistributions()), or NULL if no table has been
+ * loaded. Like the solution, it is mapped directly from its file.
+ */
+extern struct distributiontable const *distributions;
+
+/* Return the filename of the distribution table to use: the value of
+ * the environment variable YAHTZEE_DISTRIBUTION if it is set,
+ * otherwise .yahtzee-distribution in the user's home directory.
+ */
+extern char const *distributionpath(void);
+
+/* Write a distribution table to a file, in the same manner as
+ * savesolution(). Returns false if an error occurred.
+ */
+extern int savedistributions(char const *filename,
+			     struct distributiontable const *table);
+
+/* Map a distribution file into memory, in the same manner as
+ * loadsolution().
+ */
+extern int loaddistributions(char const *filename);
+
+/* The table of probabilities of reaching each target score (as
+ * produced by solvetargets()), or NULL if no table has been loaded.
+ * It is also mapped directly from its file.
+ */
+extern unsigned short const *targets;
+
+/* Return the filename of the target table to use: the value of the
+ * environment variable YAHTZEE_TARGETS if it is set, otherwise
+ * .yahtzee-targets in the user's home directory.
+ */
+extern char const *targetpath(void);
+
+/* Write a target table to a file, in the same manner as
+ * savesolution(). Returns false if an error occurred.
+ */
+extern int savetargets(char const *filename, unsigned short const *table);
+
+/* Map a target file into memory, in the same manner as
+ * loadsolution().
+ */
+extern int loadtargets(char const *filename);
+
+/* Check the contents of the solution, distribution and target files
+ * at their default paths against the checksums in their headers,
+ * displaying the result for each. Missing files are not an error.
+ * Returns false if any file is unusable or corrupted.
+ */
+extern int verifyfiles(void);
+
+#endif
@@ -0,0 +1,714 @@
+/* solver.c: Computing the optimal strategy.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "hand.h"
+#include "tables.h"
+#include "transitions.h"
+#include "solver.h"
+
+/* The number of pairs of a hand and a distinct keep that can be made
+ * from it.
+ */
+#define	handkeep_count		4368
+
+/* The slot control that corresponds to each category.
+ */
+int const categoryslots[category_count] = {
+    ctl_slot_ones, ctl_slot_twos, ctl_slot_threes,
+    ctl_slot_fours, ctl_slot_fives, ctl_slot_sixes,
+    ctl_slot_threeofakind, ctl_slot_fourofakind, ctl_slot_fullhouse,
+    ctl_slot_smallstraight, ctl_slot_largestraight, ctl_slot_yahtzee,
+    ctl_slot_chance
+};
+
+/* For each hand, the distinct keeps that can be made from it. The
+ * entries for hand h run from handkeepstart[h] up to
+ * handkeepstart[h + 1].
+ */
+static int handkeepstart[hand_count + 1];
+static unsigned short handkeeps[handkeep_count];
+
+/* The probability of each hand on a roll of all five dice.
+ */
+static double handodds[hand_count];
+
+/* For each possible set of used upper categories, a bitmask of the
+ * capped subtotals that can occur.
+ */
+static unsigned long long reachablesubtotals[64];
+
+/* Every category mask, grouped into layers by the number of used
+ * categories. The masks in layer n run from layerstart[n] up to
+ * layerstart[n + 1]. The states within a layer only depend on states
+ * in later layers, so each layer can be solved in parallel.
+ */
+static int layermasks[categorymask_count];
+static int layerstart[category_count + 2];
+
+/* The largest number of worker threads the solver will use.
+ */
+#define	maxworkers		256
+
+/* A worker thread. The range of entries in layermasks that the
+ * worker has yet to solve in the current layer is packed into one
+ * word, with the start in the low half and the end in the high
+ * half, so that the worker and any thieves can update it with a
+ * single compare-and-swap. The worker takes entries from the bottom
+ * of its range, and thieves take half of the range from the top.
+ * Each worker gets its own cache line.
+ */
+struct worker {
+    unsigned long long range;		/* the entries left to solve */
+    double busytime[category_count + 1]; /* time spent solving, per layer */
+    pthread_t thread;			/* the worker's thread */
+    int id;				/* the worker's position in the pool */
+} __attribute__((aligned(64)));
+
+/* The state shared by all of the worker threads during a solve.
+ */
+static struct {
+    void (*solve)(void*, int);		/* the function solving one mask */
+    void (*finishlayer)(void*, int);	/* called after each layer */
+    void *data;				/* the argument to both */
+    struct worker workers[maxworkers];	/* the pool of workers */
+    int workercount;			/* the number of workers */
+    pthread_barrier_t barrier;		/* where workers finish a layer */
+    double starttime;			/* when the solve began */
+    double layerend[category_count + 1]; /* when each layer finished */
+} pool;
+
+/*
+ * Initialization.
+ */
+
+/* Select the implementation of the transition matrix, and build the
+ * lists of distinct keeps and the sets of reachable subtotals. (The
+ * largest possible uncapped subtotal is 105.)
+ */
+static void buildsolver(void)
+{
+    unsigned char sums[105 + 1];
+    int k, h, n, mask, face, s, i;
+
+    inittransitions();
+
+    n = 0;
+    for (h = 0 ; h < hand_count ; ++h) {
+	handkeepstart[h] = n;
+	for (mask = 0 ; mask < 1 << ctl_dice_count ; ++mask) {
+	    k = keepindices[h][mask];
+	    for (i = handkeepstart[h] ; i < n ; ++i)
+		if (handkeeps[i] == k)
+		    break;
+	    if (i == n)
+		handkeeps[n++] = k;
+	}
+	handodds[h] = rollodds[keepindex(handlist[h])];
+    }
+    handkeepstart[hand_count] = n;
+
+    n = 0;
+    for (i = 0 ; i <= category_count ; ++i) {
+	layerstart[i] = n;
+	for (mask = 0 ; mask < categorymask_count ; ++mask)
+	    if (__builtin_popcount(mask) == i)
+		layermasks[n++] = mask;
+    }
+    layerstart[category_count + 1] = n;
+
+    for (mask = 0 ; mask < 64 ; ++mask) {
+	for (s = 0 ; s < (int)sizeof sums ; ++s)
+	    sums[s] = s == 0;
+	for (face = 0 ; face < 6 ; ++face) {
+	    if (!(mask & (1 << face)))
+		continue;
+	    for (s = sizeof sums - 1 ; s >= 0 ; --s)
+		if (sums[s])
+		    for (i = 1 ; i <= 5 ; ++i)
+			sums[s + (face + 1) * i] = 1;
+	}
+	reachablesubtotals[mask] = 0;
+	for (s = 0 ; s < (int)sizeof sums ; ++s)
+	    if (sums[s])
+		reachablesubtotals[mask] |= 1ULL << (s < 63 ? s : 63);
+    }
+}
+
+/*
+ * Evaluating a single turn.
+ */
+
+/* The lazy solver (see below) and the evaluation of a turn call each
+ * other recursively.
+ */
+static float lazyvalue(int mask, int subtotal);
+
+/* Find the value of scoring in each open category from a state: the
+ * score earned (plus the bonus, if the subtotal reaches 63) plus the
+ * expected score of the rest of the game. For the upper categories
+ * this depends only on the number of dice showing the category's
+ * face, and so a value is stored for each number. For the lower
+ * categories, the expected score of the rest of the game is stored
+ * by itself. The expected scores are taken from the table, or from
+ * the lazy solver if table is NULL.
+ */
+static void findsuccessors(float const *table, int mask, int subtotal,
+			   float (*successors)[ctl_dice_count + 1])
+{
+    int c, n, score, next;
+
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	if (c >= 6) {
+	    successors[c][0] = table ? table[stateindex(mask | (1 << c),
+							subtotal)]
+				     : lazyvalue(mask | (1 << c), subtotal);
+	    continue;
+	}
+	for (n = 0 ; n <= ctl_dice_count ; ++n) {
+	    score = (c + 1) * n;
+	    next = subtotal + score;
+	    if (next >= 63) {
+		next = 63;
+		if (subtotal < 63)
+		    score += 35;
+	    }
+	    successors[c][n] = score + (table ?
+				table[stateindex(mask | (1 << c), next)] :
+				lazyvalue(mask | (1 << c), next));
+	}
+    }
+}
+
+/* Compute the value of a hand at the end of a turn, which is the
+ * best choice of open category. The best category is stored in
+ * category.
+ */
+static double scorehandvalue(float (*successors)[ctl_dice_count + 1],
+			     int mask, int h, int *category)
+{
+    double best, value;
+    int c;
+
+    best = 0.0;
+    *category = -1;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	if (c < 6)
+	    value = successors[c][handcount(handlist[h], c)];
+	else
+	    value = handscores[h][categoryslots[c] - ctl_slots]
+		  + successors[c][0];
+	if (*category < 0 || best < value) {
+	    best = value;
+	    *category = c;
+	}
+    }
+    return best;
+}
+
+/* Compute the value of each hand at the end of a turn.
+ */
+static void scorehandvalues(float (*successors)[ctl_dice_count + 1],
+			    int mask, double *values)
+{
+    int h, c;
+
+    for (h = 0 ; h < hand_count ; ++h)
+	values[h] = scorehandvalue(successors, mask, h, &c);
+}
+
+/* Find the best keep for a hand, given the value of each keep.
+ * Masks are tried from keeping every die down, so that ties favor
+ * rerolling fewer dice. The return value is the mask of the keep,
+ * with bit n selecting the nth die of the hand in ascending order.
+ */
+static int bestkeep(double const *keepvalues, int h)
+{
+    double best;
+    int bestmask, mask;
+
+    best = -1.0;
+    bestmask = 0;
+    for (mask = (1 << ctl_dice_count) - 1 ; mask >= 0 ; --mask) {
+	if (best < keepvalues[keepindices[h][mask]]) {
+	    best = keepvalues[keepindices[h][mask]];
+	    bestmask = mask;
+	}
+    }
+    return bestmask;
+}
+
+/* Compute the value of each hand when the dice can still be
+ * rerolled, which is the value of its best keep.
+ */
+static void rerollvalues(double const *keepvalues, double *handvalues)
+{
+    double best;
+    int h, i;
+
+    for (h = 0 ; h < hand_count ; ++h) {
+	best = 0.0;
+	for (i = handkeepstart[h] ; i < handkeepstart[h + 1] ; ++i)
+	    if (best < keepvalues[handkeeps[i]])
+		best = keepvalues[handkeeps[i]];
+	handvalues[h] = best;
+    }
+}
+
+/* Compute the expected score of the rest of the game from the start
+ * of a turn, working backwards from the final roll of the turn to the
+ * first.
+ */
+static double solvestate(float const *table, int mask, int subtotal)
+{
+    float successors[category_count][ctl_dice_count + 1];
+    double hands[hand_count], keeps[keep_count];
+    double sum;
+    int h;
+
+    findsuccessors(table, mask, subtotal, successors);
+    scorehandvalues(successors, mask, hands);
+    expectkeeps(hands, keeps);
+    rerollvalues(keeps, hands);
+    expectkeeps(hands, keeps);
+    rerollvalues(keeps, hands);
+    sum = 0.0;
+    for (h = 0 ; h < hand_count ; ++h)
+	sum += handodds[h] * hands[h];
+    return sum;
+}
+
+/* Solve all of the states for one category mask. Each state's value
+ * is computed independently, so the results are the same no matter
+ * which thread computes them.
+ */
+static void solvemask(void *data, int mask)
+{
+    float *table = data;
+    int subtotal;
+
+    for (subtotal = 0 ; subtotal < subtotal_count ; ++subtotal) {
+	if (mask == categorymask_count - 1 ||
+			!(reachablesubtotals[mask & 63] & (1ULL << subtotal)))
+	    table[stateindex(mask, subtotal)] = 0.0;
+	else
+	    table[stateindex(mask, subtotal)] =
+				solvestate(table, mask, subtotal);
+    }
+}
+
+/*
+ * The lazy solver.
+ */
+
+/* The number of entries in the lazy solver's cache, which must be a
+ * power of two. Each entry takes eight bytes. There are 357568
+ * reachable states, but with 2^19 entries some ten thousand of them
+ * hash to sets that are already full. At the default of 2^20 entries
+ * no set is asked to hold more than four reachable states, so nothing
+ * is ever evicted or computed twice; a smaller cache trades memory
+ * for recomputation.
+ */
+#ifndef LAZYCACHE_ENTRIES
+#define	LAZYCACHE_ENTRIES	(1 << 20)
+#endif
+
+/* The cache is divided into sets of four entries, each set filling
+ * half of a cache line, and each state can only be stored in the set
+ * selected by its hash.
+ */
+#define	lazycache_ways		4
+
+/* An entry in the cache. The key is the state's index plus one, so
+ * that a key of zero marks an empty entry.
+ */
+struct lazyentry {
+    unsigned int key;
+    float value;
+};
+
+/* The cache, which is allocated when first used, and the number of
+ * bits in a set number.
+ */
+static struct lazyentry *lazycache = NULL;
+static int lazysetbits;
+
+/* The number of categories still open in the state of a cache entry,
+ * which determines how much work it is to recompute.
+ */
+#define	lazycost(entry)	\
+    (category_count - __builtin_popcount(((entry).key - 1) / subtotal_count))
+
+/* Return the expected score of the rest of the game from a state,
+ * computing it (and, recursively, any states that follow it) if it
+ * is not in the cache. When a set is full, the entry evicted is the
+ * one with the fewest open categories, since it is the cheapest to
+ * recompute, and among those the oldest. The entries in each set are
+ * kept in order from newest to oldest.
+ */
+static float lazyvalue(int mask, int subtotal)
+{
+    struct lazyentry *set;
+    unsigned int key;
+    float value;
+    int victim, i;
+
+    if (mask == categorymask_count - 1)
+	return 0.0;
+    if (!lazycache) {
+	lazycache = allocate(LAZYCACHE_ENTRIES * sizeof *lazycache);
+	memset(lazycache, 0, LAZYCACHE_ENTRIES * sizeof *lazycache);
+	for (lazysetbits = 0 ;
+	     (lazycache_ways << lazysetbits) < LAZYCACHE_ENTRIES ;
+	     ++lazysetbits) ;
+    }
+
+    key = stateindex(mask, subtotal) + 1;
+    set = lazycache;
+    if (lazysetbits)
+	set += ((key * 2654435761U) >> (32 - lazysetbits)) * lazycache_ways;
+    for (i = 0 ; i < lazycache_ways ; ++i)
+	if (set[i].key == key)
+	    return set[i].value;
+
+    value = solvestate(NULL, mask, subtotal);
+
+    victim = lazycache_ways - 1;
+    for (i = lazycache_ways - 2 ; i >= 0 ; --i)
+	if (set[victim].key && (!set[i].key ||
+				lazycost(set[i]) < lazycost(set[victim])))
+	    victim = i;
+    memmove(set + 1, set, victim * sizeof *set);
+    set[0].key = key;
+    set[0].value = value;
+    return value;
+}
+
+/*
+ * Choosing moves.
+ */
+
+/* Compute the value of each keep from the dice, and pick the one
+ * with the best value.
+ */
+int choosekeep(float const *table, int mask, int subtotal,
+	       unsigned char const *dice, int rerolls)
+{
+    float successors[category_count][ctl_dice_count + 1];
+    double hands[hand_count];
+
+    initsolver();
+    findsuccessors(table, mask, subtotal, successors);
+    scorehandvalues(successors, mask, hands);
+    return choosekeepbyvalue(hands, dice, rerolls);
+}
+
+/* Work backwards from the end of the turn to the current roll, and
+ * then pick the keep with the best value.
+ */
+int choosekeepbyvalue(double const *handvalues, unsigned char const *dice,
+		      int rerolls)
+{
+    double hands[hand_count], keeps[keep_count];
+    int order[ctl_dice_count];
+    int h, keepmask, sortedmask, i;
+
+    initsolver();
+    h = sortdice(dice, order);
+    expectkeeps(handvalues, keeps);
+    if (rerolls > 1) {
+	rerollvalues(keeps, hands);
+	expectkeeps(hands, keeps);
+    }
+
+    sortedmask = bestkeep(keeps, h);
+    keepmask = 0;
+    for (i = 0 ; i < ctl_dice_count ; ++i)
+	if (sortedmask & (1 << i))
+	    keepmask |= 1 << order[i];
+    return keepmask;
+}
+
+/* Pick the category that gives the dice the best value.
+ */
+int choosecategory(float const *table, int mask, int subtotal,
+		   unsigned char const *dice)
+{
+    float successors[category_count][ctl_dice_count + 1];
+    int category;
+
+    initsolver();
+    findsuccessors(table, mask, subtotal, successors);
+    scorehandvalue(successors, mask, sortdice(dice, NULL), &category);
+    return category;
+}
+
+/* Find every choice of a turn at once, in the same way as
+ * choosekeep() and choosecategory().
+ */
+void findturnpolicy(float const *table, int mask, int subtotal,
+		    struct turnpolicy *policy)
+{
+    float successors[category_count][ctl_dice_count + 1];
+    double hands[hand_count], keeps[keep_count];
+    int rerolls, h, c;
+
+    initsolver();
+    findsuccessors(table, mask, subtotal, successors);
+    for (h = 0 ; h < hand_count ; ++h) {
+	hands[h] = scorehandvalue(successors, mask, h, &c);
+	policy->categories[h] = c;
+    }
+    for (rerolls = 0 ; rerolls < 2 ; ++rerolls) {
+	expectkeeps(hands, keeps);
+	for (h = 0 ; h < hand_count ; ++h) {
+	    policy->keeps[rerolls][h] = keepindices[h][bestkeep(keeps, h)];
+	    hands[h] = keeps[policy->keeps[rerolls][h]];
+	}
+    }
+}
+
+/* Build the tables exactly once, however many threads ask for them
+ * at the same time.
+ */
+void initsolver(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, buildsolver);
+}
+
+/* Add up the dice as a hand, visiting them in order of face when the
+ * order is wanted.
+ */
+int sortdice(unsigned char const *dice, int *order)
+{
+    hand h;
+    int face, i, n;
+
+    h = 0;
+    if (!order) {
+	for (i = 0 ; i < ctl_dice_count ; ++i)
+	    handadddie(h, dice[i]);
+	return handindex(h);
+    }
+    n = 0;
+    for (face = 0 ; face < 6 ; ++face) {
+	for (i = 0 ; i < ctl_dice_count ; ++i) {
+	    if (dice[i] == face) {
+		handadddie(h, face);
+		order[n++] = i;
+	    }
+	}
+    }
+    return handindex(h);
+}
+
+/* Return true if a turn-start state can occur in a game.
+ */
+int isreachable(int mask, int subtotal)
+{
+    initsolver();
+    return (reachablesubtotals[mask & 63] >> subtotal) & 1;
+}
+
+/*
+ * The work-stealing thread pool.
+ */
+
+/* Return the current time in seconds.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Pack a range of entries into one word.
+ */
+static unsigned long long makerange(unsigned int begin, unsigned int end)
+{
+    return (unsigned long long)end << 32 | begin;
+}
+
+/* Take the next entry from the bottom of a worker's range. Returns -1
+ * if the range is empty.
+ */
+static int popentry(struct worker *worker)
+{
+    unsigned long long range;
+    unsigned int begin, end;
+
+    range = __atomic_load_n(&worker->range, __ATOMIC_ACQUIRE);
+    do {
+	begin = range & 0xFFFFFFFF;
+	end = range >> 32;
+	if (begin >= end)
+	    return -1;
+    } while (!__atomic_compare_exchange_n(&worker->range, &range,
+					  makerange(begin + 1, end), 0,
+					  __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+    return begin;
+}
+
+/* Steal the top half of another worker's range (rounding up), and
+ * make it the thief's range. Returns false if every other worker's
+ * range is empty.
+ */
+static int stealentries(struct worker *thief)
+{
+    struct worker *victim;
+    unsigned long long range;
+    unsigned int begin, end, middle;
+    int i;
+
+    for (i = 1 ; i < pool.workercount ; ++i) {
+	victim = &pool.workers[(thief->id + i) % pool.workercount];
+	range = __atomic_load_n(&victim->range, __ATOMIC_ACQUIRE);
+	for (;;) {
+	    begin = range & 0xFFFFFFFF;
+	    end = range >> 32;
+	    if (begin >= end)
+		break;
+	    middle = begin + (end - begin) / 2;
+	    if (__atomic_compare_exchange_n(&victim->range, &range,
+					    makerange(begin, middle), 0,
+					    __ATOMIC_ACQ_REL,
+					    __ATOMIC_ACQUIRE)) {
+		__atomic_store_n(&thief->range, makerange(middle, end),
+				 __ATOMIC_RELEASE);
+		return 1;
+	    }
+	}
+    }
+    return 0;
+}
+
+/* The body of a worker thread. For each layer, the worker starts with
+ * an equal share of the masks, and once its own share is exhausted it
+ * steals from the others. When nothing is left to steal, it waits at
+ * the barrier for the rest of the pool to finish the layer.
+ */
+static void *solverthread(void *data)
+{
+    struct worker *worker = data;
+    double t;
+    int layer, begin, count, n;
+
+    for (layer = category_count ; layer >= 0 ; --layer) {
+	begin = layerstart[layer];
+	count = layerstart[layer + 1] - begin;
+	__atomic_store_n(&worker->range,
+		 makerange(begin + count * worker->id / pool.workercount,
+			   begin + count * (worker->id + 1) / pool.workercount),
+		 __ATOMIC_RELEASE);
+	worker->busytime[layer] = 0.0;
+	for (;;) {
+	    n = popentry(worker);
+	    if (n < 0) {
+		if (stealentries(worker))
+		    continue;
+		break;
+	    }
+	    t = now();
+	    pool.solve(pool.data, layermasks[n]);
+	    worker->busytime[layer] += now() - t;
+	}
+	if (pthread_barrier_wait(&pool.barrier) ==
+					PTHREAD_BARRIER_SERIAL_THREAD) {
+	    if (pool.finishlayer)
+		pool.finishlayer(pool.data, layer);
+	    pool.layerend[layer] = now();
+	}
+	pthread_barrier_wait(&pool.barrier);
+    }
+    return NULL;
+}
+
+/* Display the time taken by each layer, and how much of that time the
+ * workers spent solving states rather than idling.
+ */
+static void reportlayers(FILE *fp)
+{
+    double wall, busy, prev;
+    int layer, i;
+
+    prev = pool.starttime;
+    for (layer = category_count ; layer >= 0 ; --layer) {
+	wall = pool.layerend[layer] - prev;
+	prev = pool.layerend[layer];
+	busy = 0.0;
+	for (i = 0 ; i < pool.workercount ; ++i)
+	    busy += pool.workers[i].busytime[layer];
+	fprintf(fp, "layer %2d: %5d masks %8.3f sec  %5.1f%% efficiency\n",
+		layer, layerstart[layer + 1] - layerstart[layer], wall,
+		wall > 0.0 ? 100.0 * busy / (wall * pool.workercount) : 100.0);
+    }
+    fprintf(fp, "total:    %5d masks %8.3f sec using %d thread%s\n",
+	    categorymask_count, prev - pool.starttime, pool.workercount,
+	    pool.workercount == 1 ? "" : "s");
+}
+
+/*
+ * Exported functions.
+ */
+
+/* Run a function on every category mask, one layer at a time,
+ * starting with the layer where every category has been used.
+ */
+void solvelayers(int threadcount, void (*solve)(void*, int),
+		 void (*finishlayer)(void*, int), void *data, FILE *log)
+{
+    int i;
+
+    initsolver();
+    if (threadcount < 1)
+	threadcount = 1;
+    if (threadcount > maxworkers)
+	threadcount = maxworkers;
+    pool.solve = solve;
+    pool.finishlayer = finishlayer;
+    pool.data = data;
+    pool.workercount = threadcount;
+    if (pthread_barrier_init(&pool.barrier, NULL, threadcount))
+	croak("cannot initialize the solver's thread barrier");
+    pool.starttime = now();
+    for (i = 0 ; i < threadcount ; ++i) {
+	pool.workers[i].id = i;
+	pool.workers[i].range = 0;
+	if (pthread_create(&pool.workers[i].thread, NULL,
+			   solverthread, &pool.workers[i]))
+	    croak("cannot create solver thread %d", i);
+    }
+    for (i = 0 ; i < threadcount ; ++i)
+	pthread_join(pool.workers[i].thread, NULL);
+    pthread_barrier_destroy(&pool.barrier);
+    if (log)
+	reportlayers(log);
+}
+
+/* Solve every turn-start state.
+ */
+float *solvegame(int threadcount, FILE *log)
+{
+    float *table;
+
+    table = allocate(state_count * sizeof *table);
+    solvelayers(threadcount, solvemask, NULL, table, log);
+    return table;
+}
@@ -0,0 +1,127 @@
+/* solver.h: Computing the optimal strategy.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _solver_h_
+#define _solver_h_
+
+/* The solver describes the state of a game at the start of a turn
+ * with two values: a bitmask of the categories that have been used,
+ * and the subtotal of the upper section. Since the subtotal only
+ * matters in so far as it determines the bonus, it is capped at 63.
+ * Bits 0 through 5 of the mask are the upper section (ones through
+ * sixes), and bits 6 through 12 are the lower section (three of a
+ * kind through chance).
+ */
+#define	category_count		13
+#define	categorymask_count	(1 << category_count)
+#define	subtotal_count		64
+#define	state_count		(categorymask_count * subtotal_count)
+
+/* The index of a turn-start state in a solution table.
+ */
+#define	stateindex(mask, subtotal)	((mask) * subtotal_count + (subtotal))
+
+/* The slot control that corresponds to each category.
+ */
+extern int const categoryslots[category_count];
+
+/* Build the tables that the solver relies on. Every function here
+ * does this itself when it is first called, and it is safe for
+ * several threads to do so at once; calling it up front only moves
+ * the cost out of the first call.
+ */
+extern void initsolver(void);
+
+/* Compute the expected final score, under optimal play, of the
+ * remainder of the game from every turn-start state. The return
+ * value is a newly allocated table of state_count entries, with the
+ * expected score of the complete game at entry zero. Entries for
+ * states that cannot occur in a game are set to zero. The work is
+ * divided among threadcount threads; the results do not depend on
+ * the number of threads. If log is not NULL, the time taken by each
+ * layer of the solution is written to it.
+ */
+extern float *solvegame(int threadcount, FILE *log);
+
+/* Run solve(data, mask) once for every category mask, dividing the
+ * masks among threadcount threads. The masks are grouped into layers
+ * by the number of categories used, and the layers are run in turn,
+ * from the layer where every category has been used down to the
+ * start of the game, so that solve() can rely on the results for
+ * every mask that follows its own. After each layer, one thread
+ * calls finishlayer(data, n), where n is the layer's category count,
+ * unless finishlayer is NULL. If log is not NULL, the time taken by
+ * each layer is written to it.
+ */
+extern void solvelayers(int threadcount, void (*solve)(void*, int),
+			void (*finishlayer)(void*, int), void *data,
+			FILE *log);
+
+/* Choose which dice to keep, under optimal play, using a solution
+ * table. mask and subtotal give the state at the start of the turn,
+ * dice holds the face values (0 to 5) of the current roll, and
+ * rerolls is the number of rerolls remaining in the turn (one or
+ * two). The return value is a bitmask of the positions of the dice
+ * to keep. If all five dice are kept, the roll should be scored.
+ *
+ * If table is NULL, the expected scores are instead computed as
+ * needed, for only the states that can follow the current one, and
+ * cached for the life of the process. The first move chosen early
+ * in a game can therefore take several seconds, but later moves are
+ * found mostly or entirely in the cache. The cache is not
+ * thread-safe.
+ */
+extern int choosekeep(float const *table, int mask, int subtotal,
+		      unsigned char const *dice, int rerolls);
+
+/* Choose which dice to keep, as choosekeep() does, but given the
+ * value of each hand (indexed by hand index) at the end of the turn
+ * instead of a solution table. The values can measure anything that
+ * is to be maximized on average.
+ */
+extern int choosekeepbyvalue(double const *handvalues,
+			     unsigned char const *dice, int rerolls);
+
+/* Choose which open category to score a roll in, under optimal play,
+ * using a solution table. The arguments are as for choosekeep().
+ * Returns -1 if every category has been used.
+ */
+extern int choosecategory(float const *table, int mask, int subtotal,
+			  unsigned char const *dice);
+
+/* Every choice that optimal play makes during a turn: the category
+ * to score each hand in at the end of the turn, and the keep index of
+ * the dice to keep from each hand with one reroll remaining
+ * (keeps[0]) and with two (keeps[1]). These declarations are only
+ * visible after tables.h has been included.
+ */
+#ifdef _tables_h_
+
+struct turnpolicy {
+    signed char		categories[hand_count];
+    unsigned short	keeps[2][hand_count];
+};
+
+/* Find the choices of optimal play during a turn, as with
+ * choosekeep() and choosecategory(), for every hand at once.
+ */
+extern void findturnpolicy(float const *table, int mask, int subtotal,
+			   struct turnpolicy *policy);
+
+#endif
+
+/* Return the hand index of a roll of the dice (given as face values
+ * 0 to 5). Unless order is NULL, the positions of the dice are also
+ * stored in it sorted by face, which is the order of the dice in the
+ * keep masks that the solver's tables use.
+ */
+extern int sortdice(unsigned char const *dice, int *order);
+
+/* Return true if the given turn-start state can occur in a game.
+ */
+extern int isreachable(int mask, int subtotal);
+
+#endif
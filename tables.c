@@ -0,0 +1,9171 @@
+/* tables.c: Precomputed lookup tables.
+ *
+ * This file was generated by mktables. Do not edit.
+ */
+
+#include "yahtzee.h"
+#include "hand.h"
+#include "tables.h"
+
+unsigned char const handlowindices[512 + 3] = {
+      0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  0,  0,  0,  2,
+      2,  2,  2,  0,  0,  0,  0,  3,  3,  3,  0,  0,  0,  0,  0,  4,  4,
+      0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  3,  4,  5,
+      6,  0,  0,  0,  4,  5,  6,  7,  0,  0,  0,  0,  6,  7,  8,  0,  0,
+      0,  0,  0,  8,  9,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  7,  9, 11,  0,  0,  0,  0,
+      8, 10, 12,  0,  0,  0,  0,  0, 11, 13,  0,  0,  0,  0,  0,  0, 14,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  9, 12, 15,  0,  0,  0,  0,  0, 13, 16,  0,  0,
+      0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, 14, 18,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,
+};
+
+unsigned char const handhighindices[512 + 3] = {
+      0, 21, 36, 46, 52, 55,  0,  0, 56, 71, 81, 87, 90,  0,  0,  0, 91,
+    101,107,110,  0,  0,  0,  0,111,117,120,  0,  0,  0,  0,  0,121,124,
+      0,  0,  0,  0,  0,  0,125,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,141,151,157,
+    160,  0,  0,  0,161,171,177,180,  0,  0,  0,  0,181,187,190,  0,  0,
+      0,  0,  0,191,194,  0,  0,  0,  0,  0,  0,195,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,196,206,212,215,  0,  0,  0,  0,
+    216,222,225,  0,  0,  0,  0,  0,226,229,  0,  0,  0,  0,  0,  0,230,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,231,237,240,  0,  0,  0,  0,  0,241,244,  0,  0,
+      0,  0,  0,  0,245,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,246,249,  0,  0,  0,  0,  0,  0,250,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,
+};
+
+unsigned short const keeplowindices[512] = {
+      0,  1,  4, 10, 20, 35,  0,  0,  2,  5, 11, 21, 36,  0,  0,  0,  6,
+     12, 22, 37,  0,  0,  0,  0, 13, 23, 38,  0,  0,  0,  0,  0, 24, 39,
+      0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  7, 14, 25,
+     41,  0,  0,  0,  8, 15, 26, 42,  0,  0,  0,  0, 16, 27, 43,  0,  0,
+      0,  0,  0, 28, 44,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  9, 17, 29, 46,  0,  0,  0,  0,
+     18, 30, 47,  0,  0,  0,  0,  0, 31, 48,  0,  0,  0,  0,  0,  0, 49,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0, 19, 32, 50,  0,  0,  0,  0,  0, 33, 51,  0,  0,
+      0,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, 34, 53,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,
+};
+
+unsigned short const keephighindices[512] = {
+      0, 56, 91,111,121,125,  0,  0,126,161,181,191,195,  0,  0,  0,196,
+    216,226,230,  0,  0,  0,  0,231,241,245,  0,  0,  0,  0,  0,246,250,
+      0,  0,  0,  0,  0,  0,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,252,287,307,317,
+    321,  0,  0,  0,322,342,352,356,  0,  0,  0,  0,357,367,371,  0,  0,
+      0,  0,  0,372,376,  0,  0,  0,  0,  0,  0,377,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,378,398,408,412,  0,  0,  0,  0,
+    413,423,427,  0,  0,  0,  0,  0,428,432,  0,  0,  0,  0,  0,  0,433,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,434,444,448,  0,  0,  0,  0,  0,449,453,  0,  0,
+      0,  0,  0,  0,454,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,455,459,  0,  0,  0,  0,  0,  0,460,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,461,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,
+};
+
+hand const handlist[hand_count] = {
+         5,    12,    19,    26,    33,    40,    68,    75,    82,
+        89,    96,   131,   138,   145,   152,   194,   201,   208,
+       257,   264,   320,   516,   523,   530,   537,   544,   579,
+       586,   593,   600,   642,   649,   656,   705,   712,   768,
+      1027,  1034,  1041,  1048,  1090,  1097,  1104,  1153,  1160,
+      1216,  1538,  1545,  1552,  1601,  1608,  1664,  2049,  2056,
+      2112,  2560,  4100,  4107,  4114,  4121,  4128,  4163,  4170,
+      4177,  4184,  4226,  4233,  4240,  4289,  4296,  4352,  4611,
+      4618,  4625,  4632,  4674,  4681,  4688,  4737,  4744,  4800,
+      5122,  5129,  5136,  5185,  5192,  5248,  5633,  5640,  5696,
+      6144,  8195,  8202,  8209,  8216,  8258,  8265,  8272,  8321,
+      8328,  8384,  8706,  8713,  8720,  8769,  8776,  8832,  9217,
+      9224,  9280,  9728, 12290, 12297, 12304, 12353, 12360, 12416,
+     12801, 12808, 12864, 13312, 16385, 16392, 16448, 16896, 20480,
+     32772, 32779, 32786, 32793, 32800, 32835, 32842, 32849, 32856,
+     32898, 32905, 32912, 32961, 32968, 33024, 33283, 33290, 33297,
+     33304, 33346, 33353, 33360, 33409, 33416, 33472, 33794, 33801,
+     33808, 33857, 33864, 33920, 34305, 34312, 34368, 34816, 36867,
+     36874, 36881, 36888, 36930, 36937, 36944, 36993, 37000, 37056,
+     37378, 37385, 37392, 37441, 37448, 37504, 37889, 37896, 37952,
+     38400, 40962, 40969, 40976, 41025, 41032, 41088, 41473, 41480,
+     41536, 41984, 45057, 45064, 45120, 45568, 49152, 65539, 65546,
+     65553, 65560, 65602, 65609, 65616, 65665, 65672, 65728, 66050,
+     66057, 66064, 66113, 66120, 66176, 66561, 66568, 66624, 67072,
+     69634, 69641, 69648, 69697, 69704, 69760, 70145, 70152, 70208,
+     70656, 73729, 73736, 73792, 74240, 77824, 98306, 98313, 98320,
+     98369, 98376, 98432, 98817, 98824, 98880, 99328,102401,102408,
+    102464,102912,106496,131073,131080,131136,131584,135168,163840,
+};
+
+hand const keeplist[keep_count] = {
+         0,     1,     8,    64,     2,     9,    16,    65,    72,
+       128,     3,    10,    17,    24,    66,    73,    80,   129,
+       136,   192,     4,    11,    18,    25,    32,    67,    74,
+        81,    88,   130,   137,   144,   193,   200,   256,     5,
+        12,    19,    26,    33,    40,    68,    75,    82,    89,
+        96,   131,   138,   145,   152,   194,   201,   208,   257,
+       264,   320,   512,   513,   520,   576,   514,   521,   528,
+       577,   584,   640,   515,   522,   529,   536,   578,   585,
+       592,   641,   648,   704,   516,   523,   530,   537,   544,
+       579,   586,   593,   600,   642,   649,   656,   705,   712,
+       768,  1024,  1025,  1032,  1088,  1026,  1033,  1040,  1089,
+      1096,  1152,  1027,  1034,  1041,  1048,  1090,  1097,  1104,
+      1153,  1160,  1216,  1536,  1537,  1544,  1600,  1538,  1545,
+      1552,  1601,  1608,  1664,  2048,  2049,  2056,  2112,  2560,
+      4096,  4097,  4104,  4160,  4098,  4105,  4112,  4161,  4168,
+      4224,  4099,  4106,  4113,  4120,  4162,  4169,  4176,  4225,
+      4232,  4288,  4100,  4107,  4114,  4121,  4128,  4163,  4170,
+      4177,  4184,  4226,  4233,  4240,  4289,  4296,  4352,  4608,
+      4609,  4616,  4672,  4610,  4617,  4624,  4673,  4680,  4736,
+      4611,  4618,  4625,  4632,  4674,  4681,  4688,  4737,  4744,
+      4800,  5120,  5121,  5128,  5184,  5122,  5129,  5136,  5185,
+      5192,  5248,  5632,  5633,  5640,  5696,  6144,  8192,  8193,
+      8200,  8256,  8194,  8201,  8208,  8257,  8264,  8320,  8195,
+      8202,  8209,  8216,  8258,  8265,  8272,  8321,  8328,  8384,
+      8704,  8705,  8712,  8768,  8706,  8713,  8720,  8769,  8776,
+      8832,  9216,  9217,  9224,  9280,  9728, 12288, 12289, 12296,
+     12352, 12290, 12297, 12304, 12353, 12360, 12416, 12800, 12801,
+     12808, 12864, 13312, 16384, 16385, 16392, 16448, 16896, 20480,
+     32768, 32769, 32776, 32832, 32770, 32777, 32784, 32833, 32840,
+     32896, 32771, 32778, 32785, 32792, 32834, 32841, 32848, 32897,
+     32904, 32960, 32772, 32779, 32786, 32793, 32800, 32835, 32842,
+     32849, 32856, 32898, 32905, 32912, 32961, 32968, 33024, 33280,
+     33281, 33288, 33344, 33282, 33289, 33296, 33345, 33352, 33408,
+     33283, 33290, 33297, 33304, 33346, 33353, 33360, 33409, 33416,
+     33472, 33792, 33793, 33800, 33856, 33794, 33801, 33808, 33857,
+     33864, 33920, 34304, 34305, 34312, 34368, 34816, 36864, 36865,
+     36872, 36928, 36866, 36873, 36880, 36929, 36936, 36992, 36867,
+     36874, 36881, 36888, 36930, 36937, 36944, 36993, 37000, 37056,
+     37376, 37377, 37384, 37440, 37378, 37385, 37392, 37441, 37448,
+     37504, 37888, 37889, 37896, 37952, 38400, 40960, 40961, 40968,
+     41024, 40962, 40969, 40976, 41025, 41032, 41088, 41472, 41473,
+     41480, 41536, 41984, 45056, 45057, 45064, 45120, 45568, 49152,
+     65536, 65537, 65544, 65600, 65538, 65545, 65552, 65601, 65608,
+     65664, 65539, 65546, 65553, 65560, 65602, 65609, 65616, 65665,
+     65672, 65728, 66048, 66049, 66056, 66112, 66050, 66057, 66064,
+     66113, 66120, 66176, 66560, 66561, 66568, 66624, 67072, 69632,
+     69633, 69640, 69696, 69634, 69641, 69648, 69697, 69704, 69760,
+     70144, 70145, 70152, 70208, 70656, 73728, 73729, 73736, 73792,
+     74240, 77824, 98304, 98305, 98312, 98368, 98306, 98313, 98320,
+     98369, 98376, 98432, 98816, 98817, 98824, 98880, 99328,102400,
+    102401,102408,102464,102912,106496,131072,131073,131080,131136,
+    131584,135168,163840,
+};
+
+unsigned char const handdice[hand_count][ctl_dice_count] = {
+    {
+	0,0,0,0,0,
+    },
+    {
+	0,0,0,0,1,
+    },
+    {
+	0,0,0,1,1,
+    },
+    {
+	0,0,1,1,1,
+    },
+    {
+	0,1,1,1,1,
+    },
+    {
+	1,1,1,1,1,
+    },
+    {
+	0,0,0,0,2,
+    },
+    {
+	0,0,0,1,2,
+    },
+    {
+	0,0,1,1,2,
+    },
+    {
+	0,1,1,1,2,
+    },
+    {
+	1,1,1,1,2,
+    },
+    {
+	0,0,0,2,2,
+    },
+    {
+	0,0,1,2,2,
+    },
+    {
+	0,1,1,2,2,
+    },
+    {
+	1,1,1,2,2,
+    },
+    {
+	0,0,2,2,2,
+    },
+    {
+	0,1,2,2,2,
+    },
+    {
+	1,1,2,2,2,
+    },
+    {
+	0,2,2,2,2,
+    },
+    {
+	1,2,2,2,2,
+    },
+    {
+	2,2,2,2,2,
+    },
+    {
+	0,0,0,0,3,
+    },
+    {
+	0,0,0,1,3,
+    },
+    {
+	0,0,1,1,3,
+    },
+    {
+	0,1,1,1,3,
+    },
+    {
+	1,1,1,1,3,
+    },
+    {
+	0,0,0,2,3,
+    },
+    {
+	0,0,1,2,3,
+    },
+    {
+	0,1,1,2,3,
+    },
+    {
+	1,1,1,2,3,
+    },
+    {
+	0,0,2,2,3,
+    },
+    {
+	0,1,2,2,3,
+    },
+    {
+	1,1,2,2,3,
+    },
+    {
+	0,2,2,2,3,
+    },
+    {
+	1,2,2,2,3,
+    },
+    {
+	2,2,2,2,3,
+    },
+    {
+	0,0,0,3,3,
+    },
+    {
+	0,0,1,3,3,
+    },
+    {
+	0,1,1,3,3,
+    },
+    {
+	1,1,1,3,3,
+    },
+    {
+	0,0,2,3,3,
+    },
+    {
+	0,1,2,3,3,
+    },
+    {
+	1,1,2,3,3,
+    },
+    {
+	0,2,2,3,3,
+    },
+    {
+	1,2,2,3,3,
+    },
+    {
+	2,2,2,3,3,
+    },
+    {
+	0,0,3,3,3,
+    },
+    {
+	0,1,3,3,3,
+    },
+    {
+	1,1,3,3,3,
+    },
+    {
+	0,2,3,3,3,
+    },
+    {
+	1,2,3,3,3,
+    },
+    {
+	2,2,3,3,3,
+    },
+    {
+	0,3,3,3,3,
+    },
+    {
+	1,3,3,3,3,
+    },
+    {
+	2,3,3,3,3,
+    },
+    {
+	3,3,3,3,3,
+    },
+    {
+	0,0,0,0,4,
+    },
+    {
+	0,0,0,1,4,
+    },
+    {
+	0,0,1,1,4,
+    },
+    {
+	0,1,1,1,4,
+    },
+    {
+	1,1,1,1,4,
+    },
+    {
+	0,0,0,2,4,
+    },
+    {
+	0,0,1,2,4,
+    },
+    {
+	0,1,1,2,4,
+    },
+    {
+	1,1,1,2,4,
+    },
+    {
+	0,0,2,2,4,
+    },
+    {
+	0,1,2,2,4,
+    },
+    {
+	1,1,2,2,4,
+    },
+    {
+	0,2,2,2,4,
+    },
+    {
+	1,2,2,2,4,
+    },
+    {
+	2,2,2,2,4,
+    },
+    {
+	0,0,0,3,4,
+    },
+    {
+	0,0,1,3,4,
+    },
+    {
+	0,1,1,3,4,
+    },
+    {
+	1,1,1,3,4,
+    },
+    {
+	0,0,2,3,4,
+    },
+    {
+	0,1,2,3,4,
+    },
+    {
+	1,1,2,3,4,
+    },
+    {
+	0,2,2,3,4,
+    },
+    {
+	1,2,2,3,4,
+    },
+    {
+	2,2,2,3,4,
+    },
+    {
+	0,0,3,3,4,
+    },
+    {
+	0,1,3,3,4,
+    },
+    {
+	1,1,3,3,4,
+    },
+    {
+	0,2,3,3,4,
+    },
+    {
+	1,2,3,3,4,
+    },
+    {
+	2,2,3,3,4,
+    },
+    {
+	0,3,3,3,4,
+    },
+    {
+	1,3,3,3,4,
+    },
+    {
+	2,3,3,3,4,
+    },
+    {
+	3,3,3,3,4,
+    },
+    {
+	0,0,0,4,4,
+    },
+    {
+	0,0,1,4,4,
+    },
+    {
+	0,1,1,4,4,
+    },
+    {
+	1,1,1,4,4,
+    },
+    {
+	0,0,2,4,4,
+    },
+    {
+	0,1,2,4,4,
+    },
+    {
+	1,1,2,4,4,
+    },
+    {
+	0,2,2,4,4,
+    },
+    {
+	1,2,2,4,4,
+    },
+    {
+	2,2,2,4,4,
+    },
+    {
+	0,0,3,4,4,
+    },
+    {
+	0,1,3,4,4,
+    },
+    {
+	1,1,3,4,4,
+    },
+    {
+	0,2,3,4,4,
+    },
+    {
+	1,2,3,4,4,
+    },
+    {
+	2,2,3,4,4,
+    },
+    {
+	0,3,3,4,4,
+    },
+    {
+	1,3,3,4,4,
+    },
+    {
+	2,3,3,4,4,
+    },
+    {
+	3,3,3,4,4,
+    },
+    {
+	0,0,4,4,4,
+    },
+    {
+	0,1,4,4,4,
+    },
+    {
+	1,1,4,4,4,
+    },
+    {
+	0,2,4,4,4,
+    },
+    {
+	1,2,4,4,4,
+    },
+    {
+	2,2,4,4,4,
+    },
+    {
+	0,3,4,4,4,
+    },
+    {
+	1,3,4,4,4,
+    },
+    {
+	2,3,4,4,4,
+    },
+    {
+	3,3,4,4,4,
+    },
+    {
+	0,4,4,4,4,
+    },
+    {
+	1,4,4,4,4,
+    },
+    {
+	2,4,4,4,4,
+    },
+    {
+	3,4,4,4,4,
+    },
+    {
+	4,4,4,4,4,
+    },
+    {
+	0,0,0,0,5,
+    },
+    {
+	0,0,0,1,5,
+    },
+    {
+	0,0,1,1,5,
+    },
+    {
+	0,1,1,1,5,
+    },
+    {
+	1,1,1,1,5,
+    },
+    {
+	0,0,0,2,5,
+    },
+    {
+	0,0,1,2,5,
+    },
+    {
+	0,1,1,2,5,
+    },
+    {
+	1,1,1,2,5,
+    },
+    {
+	0,0,2,2,5,
+    },
+    {
+	0,1,2,2,5,
+    },
+    {
+	1,1,2,2,5,
+    },
+    {
+	0,2,2,2,5,
+    },
+    {
+	1,2,2,2,5,
+    },
+    {
+	2,2,2,2,5,
+    },
+    {
+	0,0,0,3,5,
+    },
+    {
+	0,0,1,3,5,
+    },
+    {
+	0,1,1,3,5,
+    },
+    {
+	1,1,1,3,5,
+    },
+    {
+	0,0,2,3,5,
+    },
+    {
+	0,1,2,3,5,
+    },
+    {
+	1,1,2,3,5,
+    },
+    {
+	0,2,2,3,5,
+    },
+    {
+	1,2,2,3,5,
+    },
+    {
+	2,2,2,3,5,
+    },
+    {
+	0,0,3,3,5,
+    },
+    {
+	0,1,3,3,5,
+    },
+    {
+	1,1,3,3,5,
+    },
+    {
+	0,2,3,3,5,
+    },
+    {
+	1,2,3,3,5,
+    },
+    {
+	2,2,3,3,5,
+    },
+    {
+	0,3,3,3,5,
+    },
+    {
+	1,3,3,3,5,
+    },
+    {
+	2,3,3,3,5,
+    },
+    {
+	3,3,3,3,5,
+    },
+    {
+	0,0,0,4,5,
+    },
+    {
+	0,0,1,4,5,
+    },
+    {
+	0,1,1,4,5,
+    },
+    {
+	1,1,1,4,5,
+    },
+    {
+	0,0,2,4,5,
+    },
+    {
+	0,1,2,4,5,
+    },
+    {
+	1,1,2,4,5,
+    },
+    {
+	0,2,2,4,5,
+    },
+    {
+	1,2,2,4,5,
+    },
+    {
+	2,2,2,4,5,
+    },
+    {
+	0,0,3,4,5,
+    },
+    {
+	0,1,3,4,5,
+    },
+    {
+	1,1,3,4,5,
+    },
+    {
+	0,2,3,4,5,
+    },
+    {
+	1,2,3,4,5,
+    },
+    {
+	2,2,3,4,5,
+    },
+    {
+	0,3,3,4,5,
+    },
+    {
+	1,3,3,4,5,
+    },
+    {
+	2,3,3,4,5,
+    },
+    {
+	3,3,3,4,5,
+    },
+    {
+	0,0,4,4,5,
+    },
+    {
+	0,1,4,4,5,
+    },
+    {
+	1,1,4,4,5,
+    },
+    {
+	0,2,4,4,5,
+    },
+    {
+	1,2,4,4,5,
+    },
+    {
+	2,2,4,4,5,
+    },
+    {
+	0,3,4,4,5,
+    },
+    {
+	1,3,4,4,5,
+    },
+    {
+	2,3,4,4,5,
+    },
+    {
+	3,3,4,4,5,
+    },
+    {
+	0,4,4,4,5,
+    },
+    {
+	1,4,4,4,5,
+    },
+    {
+	2,4,4,4,5,
+    },
+    {
+	3,4,4,4,5,
+    },
+    {
+	4,4,4,4,5,
+    },
+    {
+	0,0,0,5,5,
+    },
+    {
+	0,0,1,5,5,
+    },
+    {
+	0,1,1,5,5,
+    },
+    {
+	1,1,1,5,5,
+    },
+    {
+	0,0,2,5,5,
+    },
+    {
+	0,1,2,5,5,
+    },
+    {
+	1,1,2,5,5,
+    },
+    {
+	0,2,2,5,5,
+    },
+    {
+	1,2,2,5,5,
+    },
+    {
+	2,2,2,5,5,
+    },
+    {
+	0,0,3,5,5,
+    },
+    {
+	0,1,3,5,5,
+    },
+    {
+	1,1,3,5,5,
+    },
+    {
+	0,2,3,5,5,
+    },
+    {
+	1,2,3,5,5,
+    },
+    {
+	2,2,3,5,5,
+    },
+    {
+	0,3,3,5,5,
+    },
+    {
+	1,3,3,5,5,
+    },
+    {
+	2,3,3,5,5,
+    },
+    {
+	3,3,3,5,5,
+    },
+    {
+	0,0,4,5,5,
+    },
+    {
+	0,1,4,5,5,
+    },
+    {
+	1,1,4,5,5,
+    },
+    {
+	0,2,4,5,5,
+    },
+    {
+	1,2,4,5,5,
+    },
+    {
+	2,2,4,5,5,
+    },
+    {
+	0,3,4,5,5,
+    },
+    {
+	1,3,4,5,5,
+    },
+    {
+	2,3,4,5,5,
+    },
+    {
+	3,3,4,5,5,
+    },
+    {
+	0,4,4,5,5,
+    },
+    {
+	1,4,4,5,5,
+    },
+    {
+	2,4,4,5,5,
+    },
+    {
+	3,4,4,5,5,
+    },
+    {
+	4,4,4,5,5,
+    },
+    {
+	0,0,5,5,5,
+    },
+    {
+	0,1,5,5,5,
+    },
+    {
+	1,1,5,5,5,
+    },
+    {
+	0,2,5,5,5,
+    },
+    {
+	1,2,5,5,5,
+    },
+    {
+	2,2,5,5,5,
+    },
+    {
+	0,3,5,5,5,
+    },
+    {
+	1,3,5,5,5,
+    },
+    {
+	2,3,5,5,5,
+    },
+    {
+	3,3,5,5,5,
+    },
+    {
+	0,4,5,5,5,
+    },
+    {
+	1,4,5,5,5,
+    },
+    {
+	2,4,5,5,5,
+    },
+    {
+	3,4,5,5,5,
+    },
+    {
+	4,4,5,5,5,
+    },
+    {
+	0,5,5,5,5,
+    },
+    {
+	1,5,5,5,5,
+    },
+    {
+	2,5,5,5,5,
+    },
+    {
+	3,5,5,5,5,
+    },
+    {
+	4,5,5,5,5,
+    },
+    {
+	5,5,5,5,5,
+    },
+};
+
+unsigned char const handscores[hand_count][ctl_slots_count]
+    __attribute__((aligned(64))) = {
+    {
+	 5, 0, 0, 0, 0, 0, 0, 0, 5, 5,25, 0, 0,50, 5, 0,
+    },
+    {
+	 4, 2, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 6, 0,
+    },
+    {
+	 3, 4, 0, 0, 0, 0, 0, 0, 7, 0,25, 0, 0, 0, 7, 0,
+    },
+    {
+	 2, 6, 0, 0, 0, 0, 0, 0, 8, 0,25, 0, 0, 0, 8, 0,
+    },
+    {
+	 1, 8, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 9, 0,
+    },
+    {
+	 0,10, 0, 0, 0, 0, 0, 0,10,10,25, 0, 0,50,10, 0,
+    },
+    {
+	 4, 0, 3, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 7, 0,
+    },
+    {
+	 3, 2, 3, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 8, 0,
+    },
+    {
+	 2, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+    },
+    {
+	 1, 6, 3, 0, 0, 0, 0, 0,10, 0, 0, 0, 0, 0,10, 0,
+    },
+    {
+	 0, 8, 3, 0, 0, 0, 0, 0,11,11, 0, 0, 0, 0,11, 0,
+    },
+    {
+	 3, 0, 6, 0, 0, 0, 0, 0, 9, 0,25, 0, 0, 0, 9, 0,
+    },
+    {
+	 2, 2, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,10, 0,
+    },
+    {
+	 1, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,11, 0,
+    },
+    {
+	 0, 6, 6, 0, 0, 0, 0, 0,12, 0,25, 0, 0, 0,12, 0,
+    },
+    {
+	 2, 0, 9, 0, 0, 0, 0, 0,11, 0,25, 0, 0, 0,11, 0,
+    },
+    {
+	 1, 2, 9, 0, 0, 0, 0, 0,12, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 0, 4, 9, 0, 0, 0, 0, 0,13, 0,25, 0, 0, 0,13, 0,
+    },
+    {
+	 1, 0,12, 0, 0, 0, 0, 0,13,13, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 0, 2,12, 0, 0, 0, 0, 0,14,14, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 0, 0,15, 0, 0, 0, 0, 0,15,15,25, 0, 0,50,15, 0,
+    },
+    {
+	 4, 0, 0, 4, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 8, 0,
+    },
+    {
+	 3, 2, 0, 4, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 9, 0,
+    },
+    {
+	 2, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,10, 0,
+    },
+    {
+	 1, 6, 0, 4, 0, 0, 0, 0,11, 0, 0, 0, 0, 0,11, 0,
+    },
+    {
+	 0, 8, 0, 4, 0, 0, 0, 0,12,12, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 3, 0, 3, 4, 0, 0, 0, 0,10, 0, 0, 0, 0, 0,10, 0,
+    },
+    {
+	 2, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0,30, 0, 0,11, 0,
+    },
+    {
+	 1, 4, 3, 4, 0, 0, 0, 0, 0, 0, 0,30, 0, 0,12, 0,
+    },
+    {
+	 0, 6, 3, 4, 0, 0, 0, 0,13, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 2, 0, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 1, 2, 6, 4, 0, 0, 0, 0, 0, 0, 0,30, 0, 0,13, 0,
+    },
+    {
+	 0, 4, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 1, 0, 9, 4, 0, 0, 0, 0,14, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 0, 2, 9, 4, 0, 0, 0, 0,15, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 0,12, 4, 0, 0, 0, 0,16,16, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 3, 0, 0, 8, 0, 0, 0, 0,11, 0,25, 0, 0, 0,11, 0,
+    },
+    {
+	 2, 2, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 1, 4, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 0, 6, 0, 8, 0, 0, 0, 0,14, 0,25, 0, 0, 0,14, 0,
+    },
+    {
+	 2, 0, 3, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 1, 2, 3, 8, 0, 0, 0, 0, 0, 0, 0,30, 0, 0,14, 0,
+    },
+    {
+	 0, 4, 3, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 1, 0, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 2, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 0, 9, 8, 0, 0, 0, 0,17, 0,25, 0, 0, 0,17, 0,
+    },
+    {
+	 2, 0, 0,12, 0, 0, 0, 0,14, 0,25, 0, 0, 0,14, 0,
+    },
+    {
+	 1, 2, 0,12, 0, 0, 0, 0,15, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 4, 0,12, 0, 0, 0, 0,16, 0,25, 0, 0, 0,16, 0,
+    },
+    {
+	 1, 0, 3,12, 0, 0, 0, 0,16, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 2, 3,12, 0, 0, 0, 0,17, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 0, 6,12, 0, 0, 0, 0,18, 0,25, 0, 0, 0,18, 0,
+    },
+    {
+	 1, 0, 0,16, 0, 0, 0, 0,17,17, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 2, 0,16, 0, 0, 0, 0,18,18, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 0, 3,16, 0, 0, 0, 0,19,19, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 0, 0,20, 0, 0, 0, 0,20,20,25, 0, 0,50,20, 0,
+    },
+    {
+	 4, 0, 0, 0, 5, 0, 0, 0, 9, 9, 0, 0, 0, 0, 9, 0,
+    },
+    {
+	 3, 2, 0, 0, 5, 0, 0, 0,10, 0, 0, 0, 0, 0,10, 0,
+    },
+    {
+	 2, 4, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,11, 0,
+    },
+    {
+	 1, 6, 0, 0, 5, 0, 0, 0,12, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 0, 8, 0, 0, 5, 0, 0, 0,13,13, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 3, 0, 3, 0, 5, 0, 0, 0,11, 0, 0, 0, 0, 0,11, 0,
+    },
+    {
+	 2, 2, 3, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 1, 4, 3, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 0, 6, 3, 0, 5, 0, 0, 0,14, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 2, 0, 6, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 1, 2, 6, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 0, 4, 6, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 1, 0, 9, 0, 5, 0, 0, 0,15, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 2, 9, 0, 5, 0, 0, 0,16, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 0,12, 0, 5, 0, 0, 0,17,17, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 3, 0, 0, 4, 5, 0, 0, 0,12, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 2, 2, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 1, 4, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 0, 6, 0, 4, 5, 0, 0, 0,15, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 2, 0, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 1, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0,30,40, 0,15, 0,
+    },
+    {
+	 0, 4, 3, 4, 5, 0, 0, 0, 0, 0, 0,30, 0, 0,16, 0,
+    },
+    {
+	 1, 0, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 2, 6, 4, 5, 0, 0, 0, 0, 0, 0,30, 0, 0,17, 0,
+    },
+    {
+	 0, 0, 9, 4, 5, 0, 0, 0,18, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 2, 0, 0, 8, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 1, 2, 0, 8, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 4, 0, 8, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 1, 0, 3, 8, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 2, 3, 8, 5, 0, 0, 0, 0, 0, 0,30, 0, 0,18, 0,
+    },
+    {
+	 0, 0, 6, 8, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 1, 0, 0,12, 5, 0, 0, 0,18, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 2, 0,12, 5, 0, 0, 0,19, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 0, 3,12, 5, 0, 0, 0,20, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 0, 0,16, 5, 0, 0, 0,21,21, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 3, 0, 0, 0,10, 0, 0, 0,13, 0,25, 0, 0, 0,13, 0,
+    },
+    {
+	 2, 2, 0, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 1, 4, 0, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 6, 0, 0,10, 0, 0, 0,16, 0,25, 0, 0, 0,16, 0,
+    },
+    {
+	 2, 0, 3, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 1, 2, 3, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 4, 3, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 1, 0, 6, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 2, 6, 0,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 0, 9, 0,10, 0, 0, 0,19, 0,25, 0, 0, 0,19, 0,
+    },
+    {
+	 2, 0, 0, 4,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 1, 2, 0, 4,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 4, 0, 4,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 1, 0, 3, 4,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 2, 3, 4,10, 0, 0, 0, 0, 0, 0,30, 0, 0,19, 0,
+    },
+    {
+	 0, 0, 6, 4,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 1, 0, 0, 8,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 2, 0, 8,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 0, 3, 8,10, 0, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 0, 0,12,10, 0, 0, 0,22, 0,25, 0, 0, 0,22, 0,
+    },
+    {
+	 2, 0, 0, 0,15, 0, 0, 0,17, 0,25, 0, 0, 0,17, 0,
+    },
+    {
+	 1, 2, 0, 0,15, 0, 0, 0,18, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 4, 0, 0,15, 0, 0, 0,19, 0,25, 0, 0, 0,19, 0,
+    },
+    {
+	 1, 0, 3, 0,15, 0, 0, 0,19, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 2, 3, 0,15, 0, 0, 0,20, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 0, 6, 0,15, 0, 0, 0,21, 0,25, 0, 0, 0,21, 0,
+    },
+    {
+	 1, 0, 0, 4,15, 0, 0, 0,20, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 2, 0, 4,15, 0, 0, 0,21, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 0, 3, 4,15, 0, 0, 0,22, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 0, 0, 8,15, 0, 0, 0,23, 0,25, 0, 0, 0,23, 0,
+    },
+    {
+	 1, 0, 0, 0,20, 0, 0, 0,21,21, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 2, 0, 0,20, 0, 0, 0,22,22, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 0, 3, 0,20, 0, 0, 0,23,23, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 0, 0, 4,20, 0, 0, 0,24,24, 0, 0, 0, 0,24, 0,
+    },
+    {
+	 0, 0, 0, 0,25, 0, 0, 0,25,25,25, 0, 0,50,25, 0,
+    },
+    {
+	 4, 0, 0, 0, 0, 6, 0, 0,10,10, 0, 0, 0, 0,10, 0,
+    },
+    {
+	 3, 2, 0, 0, 0, 6, 0, 0,11, 0, 0, 0, 0, 0,11, 0,
+    },
+    {
+	 2, 4, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 1, 6, 0, 0, 0, 6, 0, 0,13, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 0, 8, 0, 0, 0, 6, 0, 0,14,14, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 3, 0, 3, 0, 0, 6, 0, 0,12, 0, 0, 0, 0, 0,12, 0,
+    },
+    {
+	 2, 2, 3, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 1, 4, 3, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 0, 6, 3, 0, 0, 6, 0, 0,15, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 2, 0, 6, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 1, 2, 6, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 4, 6, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 1, 0, 9, 0, 0, 6, 0, 0,16, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 2, 9, 0, 0, 6, 0, 0,17, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 0,12, 0, 0, 6, 0, 0,18,18, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 3, 0, 0, 4, 0, 6, 0, 0,13, 0, 0, 0, 0, 0,13, 0,
+    },
+    {
+	 2, 2, 0, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 1, 4, 0, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 0, 6, 0, 4, 0, 6, 0, 0,16, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 2, 0, 3, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 1, 2, 3, 4, 0, 6, 0, 0, 0, 0, 0,30, 0, 0,16, 0,
+    },
+    {
+	 0, 4, 3, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 1, 0, 6, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 2, 6, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 0, 9, 4, 0, 6, 0, 0,19, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 2, 0, 0, 8, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 1, 2, 0, 8, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 4, 0, 8, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 1, 0, 3, 8, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 2, 3, 8, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 0, 6, 8, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 1, 0, 0,12, 0, 6, 0, 0,19, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 2, 0,12, 0, 6, 0, 0,20, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 0, 3,12, 0, 6, 0, 0,21, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 0, 0,16, 0, 6, 0, 0,22,22, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 3, 0, 0, 0, 5, 6, 0, 0,14, 0, 0, 0, 0, 0,14, 0,
+    },
+    {
+	 2, 2, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,15, 0,
+    },
+    {
+	 1, 4, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 0, 6, 0, 0, 5, 6, 0, 0,17, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 2, 0, 3, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 1, 2, 3, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 4, 3, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 1, 0, 6, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 2, 6, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 0, 9, 0, 5, 6, 0, 0,20, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 2, 0, 0, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 1, 2, 0, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 4, 0, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 1, 0, 3, 4, 5, 6, 0, 0, 0, 0, 0,30, 0, 0,19, 0,
+    },
+    {
+	 0, 2, 3, 4, 5, 6, 0, 0, 0, 0, 0,30,40, 0,20, 0,
+    },
+    {
+	 0, 0, 6, 4, 5, 6, 0, 0, 0, 0, 0,30, 0, 0,21, 0,
+    },
+    {
+	 1, 0, 0, 8, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 2, 0, 8, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 0, 3, 8, 5, 6, 0, 0, 0, 0, 0,30, 0, 0,22, 0,
+    },
+    {
+	 0, 0, 0,12, 5, 6, 0, 0,23, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 2, 0, 0, 0,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 1, 2, 0, 0,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 4, 0, 0,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 1, 0, 3, 0,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 2, 3, 0,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 0, 6, 0,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 1, 0, 0, 4,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 2, 0, 4,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 0, 3, 4,10, 6, 0, 0, 0, 0, 0,30, 0, 0,23, 0,
+    },
+    {
+	 0, 0, 0, 8,10, 6, 0, 0, 0, 0, 0, 0, 0, 0,24, 0,
+    },
+    {
+	 1, 0, 0, 0,15, 6, 0, 0,22, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 2, 0, 0,15, 6, 0, 0,23, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 0, 3, 0,15, 6, 0, 0,24, 0, 0, 0, 0, 0,24, 0,
+    },
+    {
+	 0, 0, 0, 4,15, 6, 0, 0,25, 0, 0, 0, 0, 0,25, 0,
+    },
+    {
+	 0, 0, 0, 0,20, 6, 0, 0,26,26, 0, 0, 0, 0,26, 0,
+    },
+    {
+	 3, 0, 0, 0, 0,12, 0, 0,15, 0,25, 0, 0, 0,15, 0,
+    },
+    {
+	 2, 2, 0, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,16, 0,
+    },
+    {
+	 1, 4, 0, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 0, 6, 0, 0, 0,12, 0, 0,18, 0,25, 0, 0, 0,18, 0,
+    },
+    {
+	 2, 0, 3, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,17, 0,
+    },
+    {
+	 1, 2, 3, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 0, 4, 3, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 1, 0, 6, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 2, 6, 0, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 0, 9, 0, 0,12, 0, 0,21, 0,25, 0, 0, 0,21, 0,
+    },
+    {
+	 2, 0, 0, 4, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,
+    },
+    {
+	 1, 2, 0, 4, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 0, 4, 0, 4, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 1, 0, 3, 4, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 2, 3, 4, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 0, 6, 4, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 1, 0, 0, 8, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 2, 0, 8, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 0, 3, 8, 0,12, 0, 0, 0, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 0, 0,12, 0,12, 0, 0,24, 0,25, 0, 0, 0,24, 0,
+    },
+    {
+	 2, 0, 0, 0, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,19, 0,
+    },
+    {
+	 1, 2, 0, 0, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,20, 0,
+    },
+    {
+	 0, 4, 0, 0, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 1, 0, 3, 0, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 2, 3, 0, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 0, 6, 0, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 1, 0, 0, 4, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 2, 0, 4, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 0, 3, 4, 5,12, 0, 0, 0, 0, 0,30, 0, 0,24, 0,
+    },
+    {
+	 0, 0, 0, 8, 5,12, 0, 0, 0, 0, 0, 0, 0, 0,25, 0,
+    },
+    {
+	 1, 0, 0, 0,10,12, 0, 0, 0, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 2, 0, 0,10,12, 0, 0, 0, 0, 0, 0, 0, 0,24, 0,
+    },
+    {
+	 0, 0, 3, 0,10,12, 0, 0, 0, 0, 0, 0, 0, 0,25, 0,
+    },
+    {
+	 0, 0, 0, 4,10,12, 0, 0, 0, 0, 0, 0, 0, 0,26, 0,
+    },
+    {
+	 0, 0, 0, 0,15,12, 0, 0,27, 0,25, 0, 0, 0,27, 0,
+    },
+    {
+	 2, 0, 0, 0, 0,18, 0, 0,20, 0,25, 0, 0, 0,20, 0,
+    },
+    {
+	 1, 2, 0, 0, 0,18, 0, 0,21, 0, 0, 0, 0, 0,21, 0,
+    },
+    {
+	 0, 4, 0, 0, 0,18, 0, 0,22, 0,25, 0, 0, 0,22, 0,
+    },
+    {
+	 1, 0, 3, 0, 0,18, 0, 0,22, 0, 0, 0, 0, 0,22, 0,
+    },
+    {
+	 0, 2, 3, 0, 0,18, 0, 0,23, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 0, 6, 0, 0,18, 0, 0,24, 0,25, 0, 0, 0,24, 0,
+    },
+    {
+	 1, 0, 0, 4, 0,18, 0, 0,23, 0, 0, 0, 0, 0,23, 0,
+    },
+    {
+	 0, 2, 0, 4, 0,18, 0, 0,24, 0, 0, 0, 0, 0,24, 0,
+    },
+    {
+	 0, 0, 3, 4, 0,18, 0, 0,25, 0, 0, 0, 0, 0,25, 0,
+    },
+    {
+	 0, 0, 0, 8, 0,18, 0, 0,26, 0,25, 0, 0, 0,26, 0,
+    },
+    {
+	 1, 0, 0, 0, 5,18, 0, 0,24, 0, 0, 0, 0, 0,24, 0,
+    },
+    {
+	 0, 2, 0, 0, 5,18, 0, 0,25, 0, 0, 0, 0, 0,25, 0,
+    },
+    {
+	 0, 0, 3, 0, 5,18, 0, 0,26, 0, 0, 0, 0, 0,26, 0,
+    },
+    {
+	 0, 0, 0, 4, 5,18, 0, 0,27, 0, 0, 0, 0, 0,27, 0,
+    },
+    {
+	 0, 0, 0, 0,10,18, 0, 0,28, 0,25, 0, 0, 0,28, 0,
+    },
+    {
+	 1, 0, 0, 0, 0,24, 0, 0,25,25, 0, 0, 0, 0,25, 0,
+    },
+    {
+	 0, 2, 0, 0, 0,24, 0, 0,26,26, 0, 0, 0, 0,26, 0,
+    },
+    {
+	 0, 0, 3, 0, 0,24, 0, 0,27,27, 0, 0, 0, 0,27, 0,
+    },
+    {
+	 0, 0, 0, 4, 0,24, 0, 0,28,28, 0, 0, 0, 0,28, 0,
+    },
+    {
+	 0, 0, 0, 0, 5,24, 0, 0,29,29, 0, 0, 0, 0,29, 0,
+    },
+    {
+	 0, 0, 0, 0, 0,30, 0, 0,30,30,25, 0, 0,50,30, 0,
+    },
+};
+
+unsigned short const keepindices[hand_count][1 << ctl_dice_count] = {
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  1,  4,  4, 10,  4, 10, 10, 20,  1,  4,
+	  4, 10,  4, 10, 10, 20,  4, 10, 10, 20, 10, 20, 20, 35,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  1,  4,  4, 10,  4, 10, 10, 20,  2,  5,
+	  5, 11,  5, 11, 11, 21,  5, 11, 11, 21, 11, 21, 21, 36,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  2,  5,  5, 11,  5, 11, 11, 21,  2,  5,
+	  5, 11,  5, 11, 11, 21,  6, 12, 12, 22, 12, 22, 22, 37,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  2,  5,  5, 11,  6, 12, 12, 22,  2,  5,
+	  5, 11,  6, 12, 12, 22,  6, 12, 12, 22, 13, 23, 23, 38,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  2,  5,  6, 12,  6, 12, 13, 23,  2,  5,
+	  6, 12,  6, 12, 13, 23,  6, 12, 13, 23, 13, 23, 24, 39,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  2,  6,  6, 13,  6, 13, 13, 24,  2,  6,
+	  6, 13,  6, 13, 13, 24,  6, 13, 13, 24, 13, 24, 24, 40,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  1,  4,  4, 10,  4, 10, 10, 20,  3,  7,
+	  7, 14,  7, 14, 14, 25,  7, 14, 14, 25, 14, 25, 25, 41,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  2,  5,  5, 11,  5, 11, 11, 21,  3,  7,
+	  7, 14,  7, 14, 14, 25,  8, 15, 15, 26, 15, 26, 26, 42,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  2,  5,  5, 11,  6, 12, 12, 22,  3,  7,
+	  7, 14,  8, 15, 15, 26,  8, 15, 15, 26, 16, 27, 27, 43,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  2,  5,  6, 12,  6, 12, 13, 23,  3,  7,
+	  8, 15,  8, 15, 16, 27,  8, 15, 16, 27, 16, 27, 28, 44,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  2,  6,  6, 13,  6, 13, 13, 24,  3,  8,
+	  8, 16,  8, 16, 16, 28,  8, 16, 16, 28, 16, 28, 28, 45,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  3,  7,  7, 14,  7, 14, 14, 25,  3,  7,
+	  7, 14,  7, 14, 14, 25,  9, 17, 17, 29, 17, 29, 29, 46,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  3,  7,  7, 14,  8, 15, 15, 26,  3,  7,
+	  7, 14,  8, 15, 15, 26,  9, 17, 17, 29, 18, 30, 30, 47,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  3,  7,  8, 15,  8, 15, 16, 27,  3,  7,
+	  8, 15,  8, 15, 16, 27,  9, 17, 18, 30, 18, 30, 31, 48,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  3,  8,  8, 16,  8, 16, 16, 28,  3,  8,
+	  8, 16,  8, 16, 16, 28,  9, 18, 18, 31, 18, 31, 31, 49,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,  3,  7,  7, 14,  9, 17, 17, 29,  3,  7,
+	  7, 14,  9, 17, 17, 29,  9, 17, 17, 29, 19, 32, 32, 50,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,  3,  7,  8, 15,  9, 17, 18, 30,  3,  7,
+	  8, 15,  9, 17, 18, 30,  9, 17, 18, 30, 19, 32, 33, 51,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,  3,  8,  8, 16,  9, 18, 18, 31,  3,  8,
+	  8, 16,  9, 18, 18, 31,  9, 18, 18, 31, 19, 33, 33, 52,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,  3,  7,  9, 17,  9, 17, 19, 32,  3,  7,
+	  9, 17,  9, 17, 19, 32,  9, 17, 19, 32, 19, 32, 34, 53,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,  3,  8,  9, 18,  9, 18, 19, 33,  3,  8,
+	  9, 18,  9, 18, 19, 33,  9, 18, 19, 33, 19, 33, 34, 54,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,  3,  9,  9, 19,  9, 19, 19, 34,  3,  9,
+	  9, 19,  9, 19, 19, 34,  9, 19, 19, 34, 19, 34, 34, 55,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  1,  4,  4, 10,  4, 10, 10, 20, 56, 57,
+	 57, 60, 57, 60, 60, 66, 57, 60, 60, 66, 60, 66, 66, 76,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  2,  5,  5, 11,  5, 11, 11, 21, 56, 57,
+	 57, 60, 57, 60, 60, 66, 58, 61, 61, 67, 61, 67, 67, 77,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  2,  5,  5, 11,  6, 12, 12, 22, 56, 57,
+	 57, 60, 58, 61, 61, 67, 58, 61, 61, 67, 62, 68, 68, 78,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  2,  5,  6, 12,  6, 12, 13, 23, 56, 57,
+	 58, 61, 58, 61, 62, 68, 58, 61, 62, 68, 62, 68, 69, 79,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  2,  6,  6, 13,  6, 13, 13, 24, 56, 58,
+	 58, 62, 58, 62, 62, 69, 58, 62, 62, 69, 62, 69, 69, 80,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  3,  7,  7, 14,  7, 14, 14, 25, 56, 57,
+	 57, 60, 57, 60, 60, 66, 59, 63, 63, 70, 63, 70, 70, 81,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  3,  7,  7, 14,  8, 15, 15, 26, 56, 57,
+	 57, 60, 58, 61, 61, 67, 59, 63, 63, 70, 64, 71, 71, 82,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  3,  7,  8, 15,  8, 15, 16, 27, 56, 57,
+	 58, 61, 58, 61, 62, 68, 59, 63, 64, 71, 64, 71, 72, 83,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  3,  8,  8, 16,  8, 16, 16, 28, 56, 58,
+	 58, 62, 58, 62, 62, 69, 59, 64, 64, 72, 64, 72, 72, 84,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,  3,  7,  7, 14,  9, 17, 17, 29, 56, 57,
+	 57, 60, 59, 63, 63, 70, 59, 63, 63, 70, 65, 73, 73, 85,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,  3,  7,  8, 15,  9, 17, 18, 30, 56, 57,
+	 58, 61, 59, 63, 64, 71, 59, 63, 64, 71, 65, 73, 74, 86,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,  3,  8,  8, 16,  9, 18, 18, 31, 56, 58,
+	 58, 62, 59, 64, 64, 72, 59, 64, 64, 72, 65, 74, 74, 87,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,  3,  7,  9, 17,  9, 17, 19, 32, 56, 57,
+	 59, 63, 59, 63, 65, 73, 59, 63, 65, 73, 65, 73, 75, 88,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,  3,  8,  9, 18,  9, 18, 19, 33, 56, 58,
+	 59, 64, 59, 64, 65, 74, 59, 64, 65, 74, 65, 74, 75, 89,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,  3,  9,  9, 19,  9, 19, 19, 34, 56, 59,
+	 59, 65, 59, 65, 65, 75, 59, 65, 65, 75, 65, 75, 75, 90,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10, 56, 57, 57, 60, 57, 60, 60, 66, 56, 57,
+	 57, 60, 57, 60, 60, 66, 91, 92, 92, 95, 92, 95, 95,101,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11, 56, 57, 57, 60, 58, 61, 61, 67, 56, 57,
+	 57, 60, 58, 61, 61, 67, 91, 92, 92, 95, 93, 96, 96,102,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12, 56, 57, 58, 61, 58, 61, 62, 68, 56, 57,
+	 58, 61, 58, 61, 62, 68, 91, 92, 93, 96, 93, 96, 97,103,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13, 56, 58, 58, 62, 58, 62, 62, 69, 56, 58,
+	 58, 62, 58, 62, 62, 69, 91, 93, 93, 97, 93, 97, 97,104,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14, 56, 57, 57, 60, 59, 63, 63, 70, 56, 57,
+	 57, 60, 59, 63, 63, 70, 91, 92, 92, 95, 94, 98, 98,105,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15, 56, 57, 58, 61, 59, 63, 64, 71, 56, 57,
+	 58, 61, 59, 63, 64, 71, 91, 92, 93, 96, 94, 98, 99,106,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16, 56, 58, 58, 62, 59, 64, 64, 72, 56, 58,
+	 58, 62, 59, 64, 64, 72, 91, 93, 93, 97, 94, 99, 99,107,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17, 56, 57, 59, 63, 59, 63, 65, 73, 56, 57,
+	 59, 63, 59, 63, 65, 73, 91, 92, 94, 98, 94, 98,100,108,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18, 56, 58, 59, 64, 59, 64, 65, 74, 56, 58,
+	 59, 64, 59, 64, 65, 74, 91, 93, 94, 99, 94, 99,100,109,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19, 56, 59, 59, 65, 59, 65, 65, 75, 56, 59,
+	 59, 65, 59, 65, 65, 75, 91, 94, 94,100, 94,100,100,110,
+    },
+    {
+	  0,  1,  1,  4, 56, 57, 57, 60, 56, 57, 57, 60, 91, 92, 92, 95, 56, 57,
+	 57, 60, 91, 92, 92, 95, 91, 92, 92, 95,111,112,112,115,
+    },
+    {
+	  0,  1,  2,  5, 56, 57, 58, 61, 56, 57, 58, 61, 91, 92, 93, 96, 56, 57,
+	 58, 61, 91, 92, 93, 96, 91, 92, 93, 96,111,112,113,116,
+    },
+    {
+	  0,  2,  2,  6, 56, 58, 58, 62, 56, 58, 58, 62, 91, 93, 93, 97, 56, 58,
+	 58, 62, 91, 93, 93, 97, 91, 93, 93, 97,111,113,113,117,
+    },
+    {
+	  0,  1,  3,  7, 56, 57, 59, 63, 56, 57, 59, 63, 91, 92, 94, 98, 56, 57,
+	 59, 63, 91, 92, 94, 98, 91, 92, 94, 98,111,112,114,118,
+    },
+    {
+	  0,  2,  3,  8, 56, 58, 59, 64, 56, 58, 59, 64, 91, 93, 94, 99, 56, 58,
+	 59, 64, 91, 93, 94, 99, 91, 93, 94, 99,111,113,114,119,
+    },
+    {
+	  0,  3,  3,  9, 56, 59, 59, 65, 56, 59, 59, 65, 91, 94, 94,100, 56, 59,
+	 59, 65, 91, 94, 94,100, 91, 94, 94,100,111,114,114,120,
+    },
+    {
+	  0,  1, 56, 57, 56, 57, 91, 92, 56, 57, 91, 92, 91, 92,111,112, 56, 57,
+	 91, 92, 91, 92,111,112, 91, 92,111,112,111,112,121,122,
+    },
+    {
+	  0,  2, 56, 58, 56, 58, 91, 93, 56, 58, 91, 93, 91, 93,111,113, 56, 58,
+	 91, 93, 91, 93,111,113, 91, 93,111,113,111,113,121,123,
+    },
+    {
+	  0,  3, 56, 59, 56, 59, 91, 94, 56, 59, 91, 94, 91, 94,111,114, 56, 59,
+	 91, 94, 91, 94,111,114, 91, 94,111,114,111,114,121,124,
+    },
+    {
+	  0, 56, 56, 91, 56, 91, 91,111, 56, 91, 91,111, 91,111,111,121, 56, 91,
+	 91,111, 91,111,111,121, 91,111,111,121,111,121,121,125,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  1,  4,  4, 10,  4, 10, 10, 20,126,127,
+	127,130,127,130,130,136,127,130,130,136,130,136,136,146,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  2,  5,  5, 11,  5, 11, 11, 21,126,127,
+	127,130,127,130,130,136,128,131,131,137,131,137,137,147,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  2,  5,  5, 11,  6, 12, 12, 22,126,127,
+	127,130,128,131,131,137,128,131,131,137,132,138,138,148,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  2,  5,  6, 12,  6, 12, 13, 23,126,127,
+	128,131,128,131,132,138,128,131,132,138,132,138,139,149,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  2,  6,  6, 13,  6, 13, 13, 24,126,128,
+	128,132,128,132,132,139,128,132,132,139,132,139,139,150,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  3,  7,  7, 14,  7, 14, 14, 25,126,127,
+	127,130,127,130,130,136,129,133,133,140,133,140,140,151,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  3,  7,  7, 14,  8, 15, 15, 26,126,127,
+	127,130,128,131,131,137,129,133,133,140,134,141,141,152,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  3,  7,  8, 15,  8, 15, 16, 27,126,127,
+	128,131,128,131,132,138,129,133,134,141,134,141,142,153,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  3,  8,  8, 16,  8, 16, 16, 28,126,128,
+	128,132,128,132,132,139,129,134,134,142,134,142,142,154,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,  3,  7,  7, 14,  9, 17, 17, 29,126,127,
+	127,130,129,133,133,140,129,133,133,140,135,143,143,155,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,  3,  7,  8, 15,  9, 17, 18, 30,126,127,
+	128,131,129,133,134,141,129,133,134,141,135,143,144,156,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,  3,  8,  8, 16,  9, 18, 18, 31,126,128,
+	128,132,129,134,134,142,129,134,134,142,135,144,144,157,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,  3,  7,  9, 17,  9, 17, 19, 32,126,127,
+	129,133,129,133,135,143,129,133,135,143,135,143,145,158,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,  3,  8,  9, 18,  9, 18, 19, 33,126,128,
+	129,134,129,134,135,144,129,134,135,144,135,144,145,159,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,  3,  9,  9, 19,  9, 19, 19, 34,126,129,
+	129,135,129,135,135,145,129,135,135,145,135,145,145,160,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10, 56, 57, 57, 60, 57, 60, 60, 66,126,127,
+	127,130,127,130,130,136,161,162,162,165,162,165,165,171,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11, 56, 57, 57, 60, 58, 61, 61, 67,126,127,
+	127,130,128,131,131,137,161,162,162,165,163,166,166,172,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12, 56, 57, 58, 61, 58, 61, 62, 68,126,127,
+	128,131,128,131,132,138,161,162,163,166,163,166,167,173,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13, 56, 58, 58, 62, 58, 62, 62, 69,126,128,
+	128,132,128,132,132,139,161,163,163,167,163,167,167,174,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14, 56, 57, 57, 60, 59, 63, 63, 70,126,127,
+	127,130,129,133,133,140,161,162,162,165,164,168,168,175,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15, 56, 57, 58, 61, 59, 63, 64, 71,126,127,
+	128,131,129,133,134,141,161,162,163,166,164,168,169,176,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16, 56, 58, 58, 62, 59, 64, 64, 72,126,128,
+	128,132,129,134,134,142,161,163,163,167,164,169,169,177,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17, 56, 57, 59, 63, 59, 63, 65, 73,126,127,
+	129,133,129,133,135,143,161,162,164,168,164,168,170,178,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18, 56, 58, 59, 64, 59, 64, 65, 74,126,128,
+	129,134,129,134,135,144,161,163,164,169,164,169,170,179,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19, 56, 59, 59, 65, 59, 65, 65, 75,126,129,
+	129,135,129,135,135,145,161,164,164,170,164,170,170,180,
+    },
+    {
+	  0,  1,  1,  4, 56, 57, 57, 60, 56, 57, 57, 60, 91, 92, 92, 95,126,127,
+	127,130,161,162,162,165,161,162,162,165,181,182,182,185,
+    },
+    {
+	  0,  1,  2,  5, 56, 57, 58, 61, 56, 57, 58, 61, 91, 92, 93, 96,126,127,
+	128,131,161,162,163,166,161,162,163,166,181,182,183,186,
+    },
+    {
+	  0,  2,  2,  6, 56, 58, 58, 62, 56, 58, 58, 62, 91, 93, 93, 97,126,128,
+	128,132,161,163,163,167,161,163,163,167,181,183,183,187,
+    },
+    {
+	  0,  1,  3,  7, 56, 57, 59, 63, 56, 57, 59, 63, 91, 92, 94, 98,126,127,
+	129,133,161,162,164,168,161,162,164,168,181,182,184,188,
+    },
+    {
+	  0,  2,  3,  8, 56, 58, 59, 64, 56, 58, 59, 64, 91, 93, 94, 99,126,128,
+	129,134,161,163,164,169,161,163,164,169,181,183,184,189,
+    },
+    {
+	  0,  3,  3,  9, 56, 59, 59, 65, 56, 59, 59, 65, 91, 94, 94,100,126,129,
+	129,135,161,164,164,170,161,164,164,170,181,184,184,190,
+    },
+    {
+	  0,  1, 56, 57, 56, 57, 91, 92, 56, 57, 91, 92, 91, 92,111,112,126,127,
+	161,162,161,162,181,182,161,162,181,182,181,182,191,192,
+    },
+    {
+	  0,  2, 56, 58, 56, 58, 91, 93, 56, 58, 91, 93, 91, 93,111,113,126,128,
+	161,163,161,163,181,183,161,163,181,183,181,183,191,193,
+    },
+    {
+	  0,  3, 56, 59, 56, 59, 91, 94, 56, 59, 91, 94, 91, 94,111,114,126,129,
+	161,164,161,164,181,184,161,164,181,184,181,184,191,194,
+    },
+    {
+	  0, 56, 56, 91, 56, 91, 91,111, 56, 91, 91,111, 91,111,111,121,126,161,
+	161,181,161,181,181,191,161,181,181,191,181,191,191,195,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,126,127,127,130,127,130,130,136,126,127,
+	127,130,127,130,130,136,196,197,197,200,197,200,200,206,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,126,127,127,130,128,131,131,137,126,127,
+	127,130,128,131,131,137,196,197,197,200,198,201,201,207,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,126,127,128,131,128,131,132,138,126,127,
+	128,131,128,131,132,138,196,197,198,201,198,201,202,208,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,126,128,128,132,128,132,132,139,126,128,
+	128,132,128,132,132,139,196,198,198,202,198,202,202,209,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,126,127,127,130,129,133,133,140,126,127,
+	127,130,129,133,133,140,196,197,197,200,199,203,203,210,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,126,127,128,131,129,133,134,141,126,127,
+	128,131,129,133,134,141,196,197,198,201,199,203,204,211,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,126,128,128,132,129,134,134,142,126,128,
+	128,132,129,134,134,142,196,198,198,202,199,204,204,212,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,126,127,129,133,129,133,135,143,126,127,
+	129,133,129,133,135,143,196,197,199,203,199,203,205,213,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,126,128,129,134,129,134,135,144,126,128,
+	129,134,129,134,135,144,196,198,199,204,199,204,205,214,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,126,129,129,135,129,135,135,145,126,129,
+	129,135,129,135,135,145,196,199,199,205,199,205,205,215,
+    },
+    {
+	  0,  1,  1,  4, 56, 57, 57, 60,126,127,127,130,161,162,162,165,126,127,
+	127,130,161,162,162,165,196,197,197,200,216,217,217,220,
+    },
+    {
+	  0,  1,  2,  5, 56, 57, 58, 61,126,127,128,131,161,162,163,166,126,127,
+	128,131,161,162,163,166,196,197,198,201,216,217,218,221,
+    },
+    {
+	  0,  2,  2,  6, 56, 58, 58, 62,126,128,128,132,161,163,163,167,126,128,
+	128,132,161,163,163,167,196,198,198,202,216,218,218,222,
+    },
+    {
+	  0,  1,  3,  7, 56, 57, 59, 63,126,127,129,133,161,162,164,168,126,127,
+	129,133,161,162,164,168,196,197,199,203,216,217,219,223,
+    },
+    {
+	  0,  2,  3,  8, 56, 58, 59, 64,126,128,129,134,161,163,164,169,126,128,
+	129,134,161,163,164,169,196,198,199,204,216,218,219,224,
+    },
+    {
+	  0,  3,  3,  9, 56, 59, 59, 65,126,129,129,135,161,164,164,170,126,129,
+	129,135,161,164,164,170,196,199,199,205,216,219,219,225,
+    },
+    {
+	  0,  1, 56, 57, 56, 57, 91, 92,126,127,161,162,161,162,181,182,126,127,
+	161,162,161,162,181,182,196,197,216,217,216,217,226,227,
+    },
+    {
+	  0,  2, 56, 58, 56, 58, 91, 93,126,128,161,163,161,163,181,183,126,128,
+	161,163,161,163,181,183,196,198,216,218,216,218,226,228,
+    },
+    {
+	  0,  3, 56, 59, 56, 59, 91, 94,126,129,161,164,161,164,181,184,126,129,
+	161,164,161,164,181,184,196,199,216,219,216,219,226,229,
+    },
+    {
+	  0, 56, 56, 91, 56, 91, 91,111,126,161,161,181,161,181,181,191,126,161,
+	161,181,161,181,181,191,196,216,216,226,216,226,226,230,
+    },
+    {
+	  0,  1,  1,  4,126,127,127,130,126,127,127,130,196,197,197,200,126,127,
+	127,130,196,197,197,200,196,197,197,200,231,232,232,235,
+    },
+    {
+	  0,  1,  2,  5,126,127,128,131,126,127,128,131,196,197,198,201,126,127,
+	128,131,196,197,198,201,196,197,198,201,231,232,233,236,
+    },
+    {
+	  0,  2,  2,  6,126,128,128,132,126,128,128,132,196,198,198,202,126,128,
+	128,132,196,198,198,202,196,198,198,202,231,233,233,237,
+    },
+    {
+	  0,  1,  3,  7,126,127,129,133,126,127,129,133,196,197,199,203,126,127,
+	129,133,196,197,199,203,196,197,199,203,231,232,234,238,
+    },
+    {
+	  0,  2,  3,  8,126,128,129,134,126,128,129,134,196,198,199,204,126,128,
+	129,134,196,198,199,204,196,198,199,204,231,233,234,239,
+    },
+    {
+	  0,  3,  3,  9,126,129,129,135,126,129,129,135,196,199,199,205,126,129,
+	129,135,196,199,199,205,196,199,199,205,231,234,234,240,
+    },
+    {
+	  0,  1, 56, 57,126,127,161,162,126,127,161,162,196,197,216,217,126,127,
+	161,162,196,197,216,217,196,197,216,217,231,232,241,242,
+    },
+    {
+	  0,  2, 56, 58,126,128,161,163,126,128,161,163,196,198,216,218,126,128,
+	161,163,196,198,216,218,196,198,216,218,231,233,241,243,
+    },
+    {
+	  0,  3, 56, 59,126,129,161,164,126,129,161,164,196,199,216,219,126,129,
+	161,164,196,199,216,219,196,199,216,219,231,234,241,244,
+    },
+    {
+	  0, 56, 56, 91,126,161,161,181,126,161,161,181,196,216,216,226,126,161,
+	161,181,196,216,216,226,196,216,216,226,231,241,241,245,
+    },
+    {
+	  0,  1,126,127,126,127,196,197,126,127,196,197,196,197,231,232,126,127,
+	196,197,196,197,231,232,196,197,231,232,231,232,246,247,
+    },
+    {
+	  0,  2,126,128,126,128,196,198,126,128,196,198,196,198,231,233,126,128,
+	196,198,196,198,231,233,196,198,231,233,231,233,246,248,
+    },
+    {
+	  0,  3,126,129,126,129,196,199,126,129,196,199,196,199,231,234,126,129,
+	196,199,196,199,231,234,196,199,231,234,231,234,246,249,
+    },
+    {
+	  0, 56,126,161,126,161,196,216,126,161,196,216,196,216,231,241,126,161,
+	196,216,196,216,231,241,196,216,231,241,231,241,246,250,
+    },
+    {
+	  0,126,126,196,126,196,196,231,126,196,196,231,196,231,231,246,126,196,
+	196,231,196,231,231,246,196,231,231,246,231,246,246,251,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  1,  4,  4, 10,  4, 10, 10, 20,252,253,
+	253,256,253,256,256,262,253,256,256,262,256,262,262,272,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  2,  5,  5, 11,  5, 11, 11, 21,252,253,
+	253,256,253,256,256,262,254,257,257,263,257,263,263,273,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  2,  5,  5, 11,  6, 12, 12, 22,252,253,
+	253,256,254,257,257,263,254,257,257,263,258,264,264,274,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  2,  5,  6, 12,  6, 12, 13, 23,252,253,
+	254,257,254,257,258,264,254,257,258,264,258,264,265,275,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  2,  6,  6, 13,  6, 13, 13, 24,252,254,
+	254,258,254,258,258,265,254,258,258,265,258,265,265,276,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,  3,  7,  7, 14,  7, 14, 14, 25,252,253,
+	253,256,253,256,256,262,255,259,259,266,259,266,266,277,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,  3,  7,  7, 14,  8, 15, 15, 26,252,253,
+	253,256,254,257,257,263,255,259,259,266,260,267,267,278,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,  3,  7,  8, 15,  8, 15, 16, 27,252,253,
+	254,257,254,257,258,264,255,259,260,267,260,267,268,279,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,  3,  8,  8, 16,  8, 16, 16, 28,252,254,
+	254,258,254,258,258,265,255,260,260,268,260,268,268,280,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,  3,  7,  7, 14,  9, 17, 17, 29,252,253,
+	253,256,255,259,259,266,255,259,259,266,261,269,269,281,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,  3,  7,  8, 15,  9, 17, 18, 30,252,253,
+	254,257,255,259,260,267,255,259,260,267,261,269,270,282,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,  3,  8,  8, 16,  9, 18, 18, 31,252,254,
+	254,258,255,260,260,268,255,260,260,268,261,270,270,283,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,  3,  7,  9, 17,  9, 17, 19, 32,252,253,
+	255,259,255,259,261,269,255,259,261,269,261,269,271,284,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,  3,  8,  9, 18,  9, 18, 19, 33,252,254,
+	255,260,255,260,261,270,255,260,261,270,261,270,271,285,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,  3,  9,  9, 19,  9, 19, 19, 34,252,255,
+	255,261,255,261,261,271,255,261,261,271,261,271,271,286,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10, 56, 57, 57, 60, 57, 60, 60, 66,252,253,
+	253,256,253,256,256,262,287,288,288,291,288,291,291,297,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11, 56, 57, 57, 60, 58, 61, 61, 67,252,253,
+	253,256,254,257,257,263,287,288,288,291,289,292,292,298,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12, 56, 57, 58, 61, 58, 61, 62, 68,252,253,
+	254,257,254,257,258,264,287,288,289,292,289,292,293,299,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13, 56, 58, 58, 62, 58, 62, 62, 69,252,254,
+	254,258,254,258,258,265,287,289,289,293,289,293,293,300,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14, 56, 57, 57, 60, 59, 63, 63, 70,252,253,
+	253,256,255,259,259,266,287,288,288,291,290,294,294,301,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15, 56, 57, 58, 61, 59, 63, 64, 71,252,253,
+	254,257,255,259,260,267,287,288,289,292,290,294,295,302,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16, 56, 58, 58, 62, 59, 64, 64, 72,252,254,
+	254,258,255,260,260,268,287,289,289,293,290,295,295,303,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17, 56, 57, 59, 63, 59, 63, 65, 73,252,253,
+	255,259,255,259,261,269,287,288,290,294,290,294,296,304,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18, 56, 58, 59, 64, 59, 64, 65, 74,252,254,
+	255,260,255,260,261,270,287,289,290,295,290,295,296,305,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19, 56, 59, 59, 65, 59, 65, 65, 75,252,255,
+	255,261,255,261,261,271,287,290,290,296,290,296,296,306,
+    },
+    {
+	  0,  1,  1,  4, 56, 57, 57, 60, 56, 57, 57, 60, 91, 92, 92, 95,252,253,
+	253,256,287,288,288,291,287,288,288,291,307,308,308,311,
+    },
+    {
+	  0,  1,  2,  5, 56, 57, 58, 61, 56, 57, 58, 61, 91, 92, 93, 96,252,253,
+	254,257,287,288,289,292,287,288,289,292,307,308,309,312,
+    },
+    {
+	  0,  2,  2,  6, 56, 58, 58, 62, 56, 58, 58, 62, 91, 93, 93, 97,252,254,
+	254,258,287,289,289,293,287,289,289,293,307,309,309,313,
+    },
+    {
+	  0,  1,  3,  7, 56, 57, 59, 63, 56, 57, 59, 63, 91, 92, 94, 98,252,253,
+	255,259,287,288,290,294,287,288,290,294,307,308,310,314,
+    },
+    {
+	  0,  2,  3,  8, 56, 58, 59, 64, 56, 58, 59, 64, 91, 93, 94, 99,252,254,
+	255,260,287,289,290,295,287,289,290,295,307,309,310,315,
+    },
+    {
+	  0,  3,  3,  9, 56, 59, 59, 65, 56, 59, 59, 65, 91, 94, 94,100,252,255,
+	255,261,287,290,290,296,287,290,290,296,307,310,310,316,
+    },
+    {
+	  0,  1, 56, 57, 56, 57, 91, 92, 56, 57, 91, 92, 91, 92,111,112,252,253,
+	287,288,287,288,307,308,287,288,307,308,307,308,317,318,
+    },
+    {
+	  0,  2, 56, 58, 56, 58, 91, 93, 56, 58, 91, 93, 91, 93,111,113,252,254,
+	287,289,287,289,307,309,287,289,307,309,307,309,317,319,
+    },
+    {
+	  0,  3, 56, 59, 56, 59, 91, 94, 56, 59, 91, 94, 91, 94,111,114,252,255,
+	287,290,287,290,307,310,287,290,307,310,307,310,317,320,
+    },
+    {
+	  0, 56, 56, 91, 56, 91, 91,111, 56, 91, 91,111, 91,111,111,121,252,287,
+	287,307,287,307,307,317,287,307,307,317,307,317,317,321,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,126,127,127,130,127,130,130,136,252,253,
+	253,256,253,256,256,262,322,323,323,326,323,326,326,332,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,126,127,127,130,128,131,131,137,252,253,
+	253,256,254,257,257,263,322,323,323,326,324,327,327,333,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,126,127,128,131,128,131,132,138,252,253,
+	254,257,254,257,258,264,322,323,324,327,324,327,328,334,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,126,128,128,132,128,132,132,139,252,254,
+	254,258,254,258,258,265,322,324,324,328,324,328,328,335,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,126,127,127,130,129,133,133,140,252,253,
+	253,256,255,259,259,266,322,323,323,326,325,329,329,336,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,126,127,128,131,129,133,134,141,252,253,
+	254,257,255,259,260,267,322,323,324,327,325,329,330,337,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,126,128,128,132,129,134,134,142,252,254,
+	254,258,255,260,260,268,322,324,324,328,325,330,330,338,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,126,127,129,133,129,133,135,143,252,253,
+	255,259,255,259,261,269,322,323,325,329,325,329,331,339,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,126,128,129,134,129,134,135,144,252,254,
+	255,260,255,260,261,270,322,324,325,330,325,330,331,340,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,126,129,129,135,129,135,135,145,252,255,
+	255,261,255,261,261,271,322,325,325,331,325,331,331,341,
+    },
+    {
+	  0,  1,  1,  4, 56, 57, 57, 60,126,127,127,130,161,162,162,165,252,253,
+	253,256,287,288,288,291,322,323,323,326,342,343,343,346,
+    },
+    {
+	  0,  1,  2,  5, 56, 57, 58, 61,126,127,128,131,161,162,163,166,252,253,
+	254,257,287,288,289,292,322,323,324,327,342,343,344,347,
+    },
+    {
+	  0,  2,  2,  6, 56, 58, 58, 62,126,128,128,132,161,163,163,167,252,254,
+	254,258,287,289,289,293,322,324,324,328,342,344,344,348,
+    },
+    {
+	  0,  1,  3,  7, 56, 57, 59, 63,126,127,129,133,161,162,164,168,252,253,
+	255,259,287,288,290,294,322,323,325,329,342,343,345,349,
+    },
+    {
+	  0,  2,  3,  8, 56, 58, 59, 64,126,128,129,134,161,163,164,169,252,254,
+	255,260,287,289,290,295,322,324,325,330,342,344,345,350,
+    },
+    {
+	  0,  3,  3,  9, 56, 59, 59, 65,126,129,129,135,161,164,164,170,252,255,
+	255,261,287,290,290,296,322,325,325,331,342,345,345,351,
+    },
+    {
+	  0,  1, 56, 57, 56, 57, 91, 92,126,127,161,162,161,162,181,182,252,253,
+	287,288,287,288,307,308,322,323,342,343,342,343,352,353,
+    },
+    {
+	  0,  2, 56, 58, 56, 58, 91, 93,126,128,161,163,161,163,181,183,252,254,
+	287,289,287,289,307,309,322,324,342,344,342,344,352,354,
+    },
+    {
+	  0,  3, 56, 59, 56, 59, 91, 94,126,129,161,164,161,164,181,184,252,255,
+	287,290,287,290,307,310,322,325,342,345,342,345,352,355,
+    },
+    {
+	  0, 56, 56, 91, 56, 91, 91,111,126,161,161,181,161,181,181,191,252,287,
+	287,307,287,307,307,317,322,342,342,352,342,352,352,356,
+    },
+    {
+	  0,  1,  1,  4,126,127,127,130,126,127,127,130,196,197,197,200,252,253,
+	253,256,322,323,323,326,322,323,323,326,357,358,358,361,
+    },
+    {
+	  0,  1,  2,  5,126,127,128,131,126,127,128,131,196,197,198,201,252,253,
+	254,257,322,323,324,327,322,323,324,327,357,358,359,362,
+    },
+    {
+	  0,  2,  2,  6,126,128,128,132,126,128,128,132,196,198,198,202,252,254,
+	254,258,322,324,324,328,322,324,324,328,357,359,359,363,
+    },
+    {
+	  0,  1,  3,  7,126,127,129,133,126,127,129,133,196,197,199,203,252,253,
+	255,259,322,323,325,329,322,323,325,329,357,358,360,364,
+    },
+    {
+	  0,  2,  3,  8,126,128,129,134,126,128,129,134,196,198,199,204,252,254,
+	255,260,322,324,325,330,322,324,325,330,357,359,360,365,
+    },
+    {
+	  0,  3,  3,  9,126,129,129,135,126,129,129,135,196,199,199,205,252,255,
+	255,261,322,325,325,331,322,325,325,331,357,360,360,366,
+    },
+    {
+	  0,  1, 56, 57,126,127,161,162,126,127,161,162,196,197,216,217,252,253,
+	287,288,322,323,342,343,322,323,342,343,357,358,367,368,
+    },
+    {
+	  0,  2, 56, 58,126,128,161,163,126,128,161,163,196,198,216,218,252,254,
+	287,289,322,324,342,344,322,324,342,344,357,359,367,369,
+    },
+    {
+	  0,  3, 56, 59,126,129,161,164,126,129,161,164,196,199,216,219,252,255,
+	287,290,322,325,342,345,322,325,342,345,357,360,367,370,
+    },
+    {
+	  0, 56, 56, 91,126,161,161,181,126,161,161,181,196,216,216,226,252,287,
+	287,307,322,342,342,352,322,342,342,352,357,367,367,371,
+    },
+    {
+	  0,  1,126,127,126,127,196,197,126,127,196,197,196,197,231,232,252,253,
+	322,323,322,323,357,358,322,323,357,358,357,358,372,373,
+    },
+    {
+	  0,  2,126,128,126,128,196,198,126,128,196,198,196,198,231,233,252,254,
+	322,324,322,324,357,359,322,324,357,359,357,359,372,374,
+    },
+    {
+	  0,  3,126,129,126,129,196,199,126,129,196,199,196,199,231,234,252,255,
+	322,325,322,325,357,360,322,325,357,360,357,360,372,375,
+    },
+    {
+	  0, 56,126,161,126,161,196,216,126,161,196,216,196,216,231,241,252,287,
+	322,342,322,342,357,367,322,342,357,367,357,367,372,376,
+    },
+    {
+	  0,126,126,196,126,196,196,231,126,196,196,231,196,231,231,246,252,322,
+	322,357,322,357,357,372,322,357,357,372,357,372,372,377,
+    },
+    {
+	  0,  1,  1,  4,  1,  4,  4, 10,252,253,253,256,253,256,256,262,252,253,
+	253,256,253,256,256,262,378,379,379,382,379,382,382,388,
+    },
+    {
+	  0,  1,  1,  4,  2,  5,  5, 11,252,253,253,256,254,257,257,263,252,253,
+	253,256,254,257,257,263,378,379,379,382,380,383,383,389,
+    },
+    {
+	  0,  1,  2,  5,  2,  5,  6, 12,252,253,254,257,254,257,258,264,252,253,
+	254,257,254,257,258,264,378,379,380,383,380,383,384,390,
+    },
+    {
+	  0,  2,  2,  6,  2,  6,  6, 13,252,254,254,258,254,258,258,265,252,254,
+	254,258,254,258,258,265,378,380,380,384,380,384,384,391,
+    },
+    {
+	  0,  1,  1,  4,  3,  7,  7, 14,252,253,253,256,255,259,259,266,252,253,
+	253,256,255,259,259,266,378,379,379,382,381,385,385,392,
+    },
+    {
+	  0,  1,  2,  5,  3,  7,  8, 15,252,253,254,257,255,259,260,267,252,253,
+	254,257,255,259,260,267,378,379,380,383,381,385,386,393,
+    },
+    {
+	  0,  2,  2,  6,  3,  8,  8, 16,252,254,254,258,255,260,260,268,252,254,
+	254,258,255,260,260,268,378,380,380,384,381,386,386,394,
+    },
+    {
+	  0,  1,  3,  7,  3,  7,  9, 17,252,253,255,259,255,259,261,269,252,253,
+	255,259,255,259,261,269,378,379,381,385,381,385,387,395,
+    },
+    {
+	  0,  2,  3,  8,  3,  8,  9, 18,252,254,255,260,255,260,261,270,252,254,
+	255,260,255,260,261,270,378,380,381,386,381,386,387,396,
+    },
+    {
+	  0,  3,  3,  9,  3,  9,  9, 19,252,255,255,261,255,261,261,271,252,255,
+	255,261,255,261,261,271,378,381,381,387,381,387,387,397,
+    },
+    {
+	  0,  1,  1,  4, 56, 57, 57, 60,252,253,253,256,287,288,288,291,252,253,
+	253,256,287,288,288,291,378,379,379,382,398,399,399,402,
+    },
+    {
+	  0,  1,  2,  5, 56, 57, 58, 61,252,253,254,257,287,288,289,292,252,253,
+	254,257,287,288,289,292,378,379,380,383,398,399,400,403,
+    },
+    {
+	  0,  2,  2,  6, 56, 58, 58, 62,252,254,254,258,287,289,289,293,252,254,
+	254,258,287,289,289,293,378,380,380,384,398,400,400,404,
+    },
+    {
+	  0,  1,  3,  7, 56, 57, 59, 63,252,253,255,259,287,288,290,294,252,253,
+	255,259,287,288,290,294,378,379,381,385,398,399,401,405,
+    },
+    {
+	  0,  2,  3,  8, 56, 58, 59, 64,252,254,255,260,287,289,290,295,252,254,
+	255,260,287,289,290,295,378,380,381,386,398,400,401,406,
+    },
+    {
+	  0,  3,  3,  9, 56, 59, 59, 65,252,255,255,261,287,290,290,296,252,255,
+	255,261,287,290,290,296,378,381,381,387,398,401,401,407,
+    },
+    {
+	  0,  1, 56, 57, 56, 57, 91, 92,252,253,287,288,287,288,307,308,252,253,
+	287,288,287,288,307,308,378,379,398,399,398,399,408,409,
+    },
+    {
+	  0,  2, 56, 58, 56, 58, 91, 93,252,254,287,289,287,289,307,309,252,254,
+	287,289,287,289,307,309,378,380,398,400,398,400,408,410,
+    },
+    {
+	  0,  3, 56, 59, 56, 59, 91, 94,252,255,287,290,287,290,307,310,252,255,
+	287,290,287,290,307,310,378,381,398,401,398,401,408,411,
+    },
+    {
+	  0, 56, 56, 91, 56, 91, 91,111,252,287,287,307,287,307,307,317,252,287,
+	287,307,287,307,307,317,378,398,398,408,398,408,408,412,
+    },
+    {
+	  0,  1,  1,  4,126,127,127,130,252,253,253,256,322,323,323,326,252,253,
+	253,256,322,323,323,326,378,379,379,382,413,414,414,417,
+    },
+    {
+	  0,  1,  2,  5,126,127,128,131,252,253,254,257,322,323,324,327,252,253,
+	254,257,322,323,324,327,378,379,380,383,413,414,415,418,
+    },
+    {
+	  0,  2,  2,  6,126,128,128,132,252,254,254,258,322,324,324,328,252,254,
+	254,258,322,324,324,328,378,380,380,384,413,415,415,419,
+    },
+    {
+	  0,  1,  3,  7,126,127,129,133,252,253,255,259,322,323,325,329,252,253,
+	255,259,322,323,325,329,378,379,381,385,413,414,416,420,
+    },
+    {
+	  0,  2,  3,  8,126,128,129,134,252,254,255,260,322,324,325,330,252,254,
+	255,260,322,324,325,330,378,380,381,386,413,415,416,421,
+    },
+    {
+	  0,  3,  3,  9,126,129,129,135,252,255,255,261,322,325,325,331,252,255,
+	255,261,322,325,325,331,378,381,381,387,413,416,416,422,
+    },
+    {
+	  0,  1, 56, 57,126,127,161,162,252,253,287,288,322,323,342,343,252,253,
+	287,288,322,323,342,343,378,379,398,399,413,414,423,424,
+    },
+    {
+	  0,  2, 56, 58,126,128,161,163,252,254,287,289,322,324,342,344,252,254,
+	287,289,322,324,342,344,378,380,398,400,413,415,423,425,
+    },
+    {
+	  0,  3, 56, 59,126,129,161,164,252,255,287,290,322,325,342,345,252,255,
+	287,290,322,325,342,345,378,381,398,401,413,416,423,426,
+    },
+    {
+	  0, 56, 56, 91,126,161,161,181,252,287,287,307,322,342,342,352,252,287,
+	287,307,322,342,342,352,378,398,398,408,413,423,423,427,
+    },
+    {
+	  0,  1,126,127,126,127,196,197,252,253,322,323,322,323,357,358,252,253,
+	322,323,322,323,357,358,378,379,413,414,413,414,428,429,
+    },
+    {
+	  0,  2,126,128,126,128,196,198,252,254,322,324,322,324,357,359,252,254,
+	322,324,322,324,357,359,378,380,413,415,413,415,428,430,
+    },
+    {
+	  0,  3,126,129,126,129,196,199,252,255,322,325,322,325,357,360,252,255,
+	322,325,322,325,357,360,378,381,413,416,413,416,428,431,
+    },
+    {
+	  0, 56,126,161,126,161,196,216,252,287,322,342,322,342,357,367,252,287,
+	322,342,322,342,357,367,378,398,413,423,413,423,428,432,
+    },
+    {
+	  0,126,126,196,126,196,196,231,252,322,322,357,322,357,357,372,252,322,
+	322,357,322,357,357,372,378,413,413,428,413,428,428,433,
+    },
+    {
+	  0,  1,  1,  4,252,253,253,256,252,253,253,256,378,379,379,382,252,253,
+	253,256,378,379,379,382,378,379,379,382,434,435,435,438,
+    },
+    {
+	  0,  1,  2,  5,252,253,254,257,252,253,254,257,378,379,380,383,252,253,
+	254,257,378,379,380,383,378,379,380,383,434,435,436,439,
+    },
+    {
+	  0,  2,  2,  6,252,254,254,258,252,254,254,258,378,380,380,384,252,254,
+	254,258,378,380,380,384,378,380,380,384,434,436,436,440,
+    },
+    {
+	  0,  1,  3,  7,252,253,255,259,252,253,255,259,378,379,381,385,252,253,
+	255,259,378,379,381,385,378,379,381,385,434,435,437,441,
+    },
+    {
+	  0,  2,  3,  8,252,254,255,260,252,254,255,260,378,380,381,386,252,254,
+	255,260,378,380,381,386,378,380,381,386,434,436,437,442,
+    },
+    {
+	  0,  3,  3,  9,252,255,255,261,252,255,255,261,378,381,381,387,252,255,
+	255,261,378,381,381,387,378,381,381,387,434,437,437,443,
+    },
+    {
+	  0,  1, 56, 57,252,253,287,288,252,253,287,288,378,379,398,399,252,253,
+	287,288,378,379,398,399,378,379,398,399,434,435,444,445,
+    },
+    {
+	  0,  2, 56, 58,252,254,287,289,252,254,287,289,378,380,398,400,252,254,
+	287,289,378,380,398,400,378,380,398,400,434,436,444,446,
+    },
+    {
+	  0,  3, 56, 59,252,255,287,290,252,255,287,290,378,381,398,401,252,255,
+	287,290,378,381,398,401,378,381,398,401,434,437,444,447,
+    },
+    {
+	  0, 56, 56, 91,252,287,287,307,252,287,287,307,378,398,398,408,252,287,
+	287,307,378,398,398,408,378,398,398,408,434,444,444,448,
+    },
+    {
+	  0,  1,126,127,252,253,322,323,252,253,322,323,378,379,413,414,252,253,
+	322,323,378,379,413,414,378,379,413,414,434,435,449,450,
+    },
+    {
+	  0,  2,126,128,252,254,322,324,252,254,322,324,378,380,413,415,252,254,
+	322,324,378,380,413,415,378,380,413,415,434,436,449,451,
+    },
+    {
+	  0,  3,126,129,252,255,322,325,252,255,322,325,378,381,413,416,252,255,
+	322,325,378,381,413,416,378,381,413,416,434,437,449,452,
+    },
+    {
+	  0, 56,126,161,252,287,322,342,252,287,322,342,378,398,413,423,252,287,
+	322,342,378,398,413,423,378,398,413,423,434,444,449,453,
+    },
+    {
+	  0,126,126,196,252,322,322,357,252,322,322,357,378,413,413,428,252,322,
+	322,357,378,413,413,428,378,413,413,428,434,449,449,454,
+    },
+    {
+	  0,  1,252,253,252,253,378,379,252,253,378,379,378,379,434,435,252,253,
+	378,379,378,379,434,435,378,379,434,435,434,435,455,456,
+    },
+    {
+	  0,  2,252,254,252,254,378,380,252,254,378,380,378,380,434,436,252,254,
+	378,380,378,380,434,436,378,380,434,436,434,436,455,457,
+    },
+    {
+	  0,  3,252,255,252,255,378,381,252,255,378,381,378,381,434,437,252,255,
+	378,381,378,381,434,437,378,381,434,437,434,437,455,458,
+    },
+    {
+	  0, 56,252,287,252,287,378,398,252,287,378,398,378,398,434,444,252,287,
+	378,398,378,398,434,444,378,398,434,444,434,444,455,459,
+    },
+    {
+	  0,126,252,322,252,322,378,413,252,322,378,413,378,413,434,449,252,322,
+	378,413,378,413,434,449,378,413,434,449,434,449,455,460,
+    },
+    {
+	  0,252,252,378,252,378,378,434,252,378,378,434,378,434,434,455,252,378,
+	378,434,378,434,434,455,378,434,434,455,434,455,455,461,
+    },
+};
+
+unsigned char const keepsizes[keep_count] = {
+    0,1,1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,1,2,2,2,3,3,3,3,3,3,4,4,
+    4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,2,3,3,3,4,4,4,4,4,4,5,
+    5,5,5,5,5,5,5,5,5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,1,2,2,2,3,3,3,3,3,3,
+    4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,2,3,3,3,4,4,4,4,4,
+    4,5,5,5,5,5,5,5,5,5,5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,2,3,3,3,4,4,4,4,
+    4,4,5,5,5,5,5,5,5,5,5,5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,3,4,4,4,5,5,5,
+    5,5,5,4,5,5,5,5,4,5,5,5,5,5,1,2,2,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,2,3,3,3,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,
+    5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,2,3,3,3,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+    5,5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,4,5,
+    5,5,5,5,2,3,3,3,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,3,4,4,4,5,5,5,5,5,5,
+    4,5,5,5,5,3,4,4,4,5,5,5,5,5,5,4,5,5,5,5,4,5,5,5,5,5,3,4,4,4,5,5,5,5,
+    5,5,4,5,5,5,5,4,5,5,5,5,5,4,5,5,5,5,5,5,
+};
+
+double const rollodds[keep_count] = {
+    1,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.16666666666666666,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0007716049382716049,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.16666666666666666,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.013888888888888888,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0030864197530864196,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.013888888888888888,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0046296296296296294,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0030864197530864196,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0007716049382716049,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.16666666666666666,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.013888888888888888,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0030864197530864196,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.027777777777777776,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.0092592592592592587,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.013888888888888888,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0092592592592592587,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0030864197530864196,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.013888888888888888,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0046296296296296294,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.013888888888888888,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0092592592592592587,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0046296296296296294,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0030864197530864196,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0030864197530864196,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0007716049382716049,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+};
+
+unsigned short const transitionrowstart[transition_blockcount + 1] = {
+        0,  252,  380,  436,  460,  468,  472,
+};
+
+unsigned short const transitionentrystart[transition_blockcount + 1] = {
+        0,  252, 1020, 2196, 3540, 4548, 5556,
+};
+
+unsigned short const transitionkeeps[transition_rowcount] = {
+     35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+     52, 53, 54, 55, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+     89, 90,101,102,103,104,105,106,107,108,109,110,115,116,117,118,119,
+    120,122,123,124,125,146,147,148,149,150,151,152,153,154,155,156,157,
+    158,159,160,171,172,173,174,175,176,177,178,179,180,185,186,187,188,
+    189,190,192,193,194,195,206,207,208,209,210,211,212,213,214,215,220,
+    221,222,223,224,225,227,228,229,230,235,236,237,238,239,240,242,243,
+    244,245,247,248,249,250,251,272,273,274,275,276,277,278,279,280,281,
+    282,283,284,285,286,297,298,299,300,301,302,303,304,305,306,311,312,
+    313,314,315,316,318,319,320,321,332,333,334,335,336,337,338,339,340,
+    341,346,347,348,349,350,351,353,354,355,356,361,362,363,364,365,366,
+    368,369,370,371,373,374,375,376,377,388,389,390,391,392,393,394,395,
+    396,397,402,403,404,405,406,407,409,410,411,412,417,418,419,420,421,
+    422,424,425,426,427,429,430,431,432,433,438,439,440,441,442,443,445,
+    446,447,448,450,451,452,453,454,456,457,458,459,460,461, 20, 21, 22,
+     23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 66, 67, 68, 69, 70,
+     71, 72, 73, 74, 75, 95, 96, 97, 98, 99,100,112,113,114,121,136,137,
+    138,139,140,141,142,143,144,145,165,166,167,168,169,170,182,183,184,
+    191,200,201,202,203,204,205,217,218,219,226,232,233,234,241,246,262,
+    263,264,265,266,267,268,269,270,271,291,292,293,294,295,296,308,309,
+    310,317,326,327,328,329,330,331,343,344,345,352,358,359,360,367,372,
+    382,383,384,385,386,387,399,400,401,408,414,415,416,423,428,435,436,
+    437,444,449,455,455,455, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 60,
+     61, 62, 63, 64, 65, 92, 93, 94,111,130,131,132,133,134,135,162,163,
+    164,181,197,198,199,216,231,256,257,258,259,260,261,288,289,290,307,
+    323,324,325,342,357,379,380,381,398,413,434,  4,  5,  6,  7,  8,  9,
+     57, 58, 59, 91,127,128,129,161,196,253,254,255,287,322,378,378,378,
+    378,  1,  2,  3, 56,126,252,252,252,  0,  0,  0,  0,
+};
+
+unsigned char const transitionhands[transition_entrycount] = {
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16,
+     17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+     34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+     51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+     68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+     85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,100,101,
+    102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,
+    119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,
+    136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,
+    153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,
+    170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,
+    187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,
+    204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,
+    221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,
+    238,239,240,241,242,243,244,245,246,247,248,249,250,251,  0,  1,  2,
+      3,  4,  6,  7,  8,  9, 11, 12, 13, 15, 16, 18, 21, 22, 23, 24, 26,
+     27, 28, 30, 31, 33, 36, 37, 38, 40, 41, 43, 46, 47, 49, 52, 56, 57,
+     58, 59, 61, 62, 63, 65, 66, 68, 71, 72, 73, 75, 76, 78, 81, 82, 84,
+     87, 91, 92, 93, 95, 96, 98,101,102,104,107,111,112,114,117,121,126,
+    127,128,129,131,132,133,135,136,138,141,142,143,145,146,148,151,152,
+    154,157,161,162,163,165,166,168,171,172,174,177,181,182,184,187,191,
+    196,197,198,200,201,203,206,207,209,212,216,217,219,222,226,231,232,
+    234,237,241,246,246,246,  1,  2,  3,  4,  5,  7,  8,  9, 10, 12, 13,
+     14, 16, 17, 19, 22, 23, 24, 25, 27, 28, 29, 31, 32, 34, 37, 38, 39,
+     41, 42, 44, 47, 48, 50, 53, 57, 58, 59, 60, 62, 63, 64, 66, 67, 69,
+     72, 73, 74, 76, 77, 79, 82, 83, 85, 88, 92, 93, 94, 96, 97, 99,102,
+    103,105,108,112,113,115,118,122,127,128,129,130,132,133,134,136,137,
+    139,142,143,144,146,147,149,152,153,155,158,162,163,164,166,167,169,
+    172,173,175,178,182,183,185,188,192,197,198,199,201,202,204,207,208,
+    210,213,217,218,220,223,227,232,233,235,238,242,247,247,247,  6,  7,
+      8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 26, 27, 28, 29,
+     30, 31, 32, 33, 34, 35, 40, 41, 42, 43, 44, 45, 49, 50, 51, 54, 61,
+     62, 63, 64, 65, 66, 67, 68, 69, 70, 75, 76, 77, 78, 79, 80, 84, 85,
+     86, 89, 95, 96, 97, 98, 99,100,104,105,106,109,114,115,116,119,123,
+    131,132,133,134,135,136,137,138,139,140,145,146,147,148,149,150,154,
+    155,156,159,165,166,167,168,169,170,174,175,176,179,184,185,186,189,
+    193,200,201,202,203,204,205,209,210,211,214,219,220,221,224,228,234,
+    235,236,239,243,248,248,248, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+     31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+     48, 49, 50, 51, 52, 53, 54, 55, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+     80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,101,102,103,104,105,106,
+    107,108,109,110,117,118,119,120,124,141,142,143,144,145,146,147,148,
+    149,150,151,152,153,154,155,156,157,158,159,160,171,172,173,174,175,
+    176,177,178,179,180,187,188,189,190,194,206,207,208,209,210,211,212,
+    213,214,215,222,223,224,225,229,237,238,239,240,244,249,249,249, 56,
+     57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+     74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+     91, 92, 93, 94, 95, 96, 97, 98, 99,100,101,102,103,104,105,106,107,
+    108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,
+    125,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,
+    177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,
+    194,195,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,
+    241,242,243,244,245,250,250,250,126,127,128,129,130,131,132,133,134,
+    135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,
+    152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,
+    169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,
+    186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,
+    203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,
+    220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,
+    237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,251,251,
+      0,  1,  2,  3,  6,  7,  8, 11, 12, 15, 21, 22, 23, 26, 27, 30, 36,
+     37, 40, 46, 56, 57, 58, 61, 62, 65, 71, 72, 75, 81, 91, 92, 95,101,
+    111,126,127,128,131,132,135,141,142,145,151,161,162,165,171,181,196,
+    197,200,206,216,231,  1,  2,  3,  4,  7,  8,  9, 12, 13, 16, 22, 23,
+     24, 27, 28, 31, 37, 38, 41, 47, 57, 58, 59, 62, 63, 66, 72, 73, 76,
+     82, 92, 93, 96,102,112,127,128,129,132,133,136,142,143,146,152,162,
+    163,166,172,182,197,198,201,207,217,232,  2,  3,  4,  5,  8,  9, 10,
+     13, 14, 17, 23, 24, 25, 28, 29, 32, 38, 39, 42, 48, 58, 59, 60, 63,
+     64, 67, 73, 74, 77, 83, 93, 94, 97,103,113,128,129,130,133,134,137,
+    143,144,147,153,163,164,167,173,183,198,199,202,208,218,233,  6,  7,
+      8,  9, 11, 12, 13, 15, 16, 18, 26, 27, 28, 30, 31, 33, 40, 41, 43,
+     49, 61, 62, 63, 65, 66, 68, 75, 76, 78, 84, 95, 96, 98,104,114,131,
+    132,133,135,136,138,145,146,148,154,165,166,168,174,184,200,201,203,
+    209,219,234,  7,  8,  9, 10, 12, 13, 14, 16, 17, 19, 27, 28, 29, 31,
+     32, 34, 41, 42, 44, 50, 62, 63, 64, 66, 67, 69, 76, 77, 79, 85, 96,
+     97, 99,105,115,132,133,134,136,137,139,146,147,149,155,166,167,169,
+    175,185,201,202,204,210,220,235, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+     20, 30, 31, 32, 33, 34, 35, 43, 44, 45, 51, 65, 66, 67, 68, 69, 70,
+     78, 79, 80, 86, 98, 99,100,106,116,135,136,137,138,139,140,148,149,
+    150,156,168,169,170,176,186,203,204,205,211,221,236, 21, 22, 23, 24,
+     26, 27, 28, 30, 31, 33, 36, 37, 38, 40, 41, 43, 46, 47, 49, 52, 71,
+     72, 73, 75, 76, 78, 81, 82, 84, 87,101,102,104,107,117,141,142,143,
+    145,146,148,151,152,154,157,171,172,174,177,187,206,207,209,212,222,
+    237, 22, 23, 24, 25, 27, 28, 29, 31, 32, 34, 37, 38, 39, 41, 42, 44,
+     47, 48, 50, 53, 72, 73, 74, 76, 77, 79, 82, 83, 85, 88,102,103,105,
+    108,118,142,143,144,146,147,149,152,153,155,158,172,173,175,178,188,
+    207,208,210,213,223,238, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 40,
+     41, 42, 43, 44, 45, 49, 50, 51, 54, 75, 76, 77, 78, 79, 80, 84, 85,
+     86, 89,104,105,106,109,119,145,146,147,148,149,150,154,155,156,159,
+    174,175,176,179,189,209,210,211,214,224,239, 36, 37, 38, 39, 40, 41,
+     42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 81, 82, 83,
+     84, 85, 86, 87, 88, 89, 90,107,108,109,110,120,151,152,153,154,155,
+    156,157,158,159,160,177,178,179,180,190,212,213,214,215,225,240, 56,
+     57, 58, 59, 61, 62, 63, 65, 66, 68, 71, 72, 73, 75, 76, 78, 81, 82,
+     84, 87, 91, 92, 93, 95, 96, 98,101,102,104,107,111,112,114,117,121,
+    161,162,163,165,166,168,171,172,174,177,181,182,184,187,191,216,217,
+    219,222,226,241, 57, 58, 59, 60, 62, 63, 64, 66, 67, 69, 72, 73, 74,
+     76, 77, 79, 82, 83, 85, 88, 92, 93, 94, 96, 97, 99,102,103,105,108,
+    112,113,115,118,122,162,163,164,166,167,169,172,173,175,178,182,183,
+    185,188,192,217,218,220,223,227,242, 61, 62, 63, 64, 65, 66, 67, 68,
+     69, 70, 75, 76, 77, 78, 79, 80, 84, 85, 86, 89, 95, 96, 97, 98, 99,
+    100,104,105,106,109,114,115,116,119,123,165,166,167,168,169,170,174,
+    175,176,179,184,185,186,189,193,219,220,221,224,228,243, 71, 72, 73,
+     74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+    101,102,103,104,105,106,107,108,109,110,117,118,119,120,124,171,172,
+    173,174,175,176,177,178,179,180,187,188,189,190,194,222,223,224,225,
+    229,244, 91, 92, 93, 94, 95, 96, 97, 98, 99,100,101,102,103,104,105,
+    106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,
+    123,124,125,181,182,183,184,185,186,187,188,189,190,191,192,193,194,
+    195,226,227,228,229,230,245,126,127,128,129,131,132,133,135,136,138,
+    141,142,143,145,146,148,151,152,154,157,161,162,163,165,166,168,171,
+    172,174,177,181,182,184,187,191,196,197,198,200,201,203,206,207,209,
+    212,216,217,219,222,226,231,232,234,237,241,246,127,128,129,130,132,
+    133,134,136,137,139,142,143,144,146,147,149,152,153,155,158,162,163,
+    164,166,167,169,172,173,175,178,182,183,185,188,192,197,198,199,201,
+    202,204,207,208,210,213,217,218,220,223,227,232,233,235,238,242,247,
+    131,132,133,134,135,136,137,138,139,140,145,146,147,148,149,150,154,
+    155,156,159,165,166,167,168,169,170,174,175,176,179,184,185,186,189,
+    193,200,201,202,203,204,205,209,210,211,214,219,220,221,224,228,234,
+    235,236,239,243,248,141,142,143,144,145,146,147,148,149,150,151,152,
+    153,154,155,156,157,158,159,160,171,172,173,174,175,176,177,178,179,
+    180,187,188,189,190,194,206,207,208,209,210,211,212,213,214,215,222,
+    223,224,225,229,237,238,239,240,244,249,161,162,163,164,165,166,167,
+    168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,
+    185,186,187,188,189,190,191,192,193,194,195,216,217,218,219,220,221,
+    222,223,224,225,226,227,228,229,230,241,242,243,244,245,250,196,197,
+    198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,
+    215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,
+    232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,
+    249,250,251,  0,  1,  2,  6,  7, 11, 21, 22, 26, 36, 56, 57, 61, 71,
+     91,126,127,131,141,161,196,196,196,196,  1,  2,  3,  7,  8, 12, 22,
+     23, 27, 37, 57, 58, 62, 72, 92,127,128,132,142,162,197,197,197,197,
+      2,  3,  4,  8,  9, 13, 23, 24, 28, 38, 58, 59, 63, 73, 93,128,129,
+    133,143,163,198,198,198,198,  3,  4,  5,  9, 10, 14, 24, 25, 29, 39,
+     59, 60, 64, 74, 94,129,130,134,144,164,199,199,199,199,  6,  7,  8,
+     11, 12, 15, 26, 27, 30, 40, 61, 62, 65, 75, 95,131,132,135,145,165,
+    200,200,200,200,  7,  8,  9, 12, 13, 16, 27, 28, 31, 41, 62, 63, 66,
+     76, 96,132,133,136,146,166,201,201,201,201,  8,  9, 10, 13, 14, 17,
+     28, 29, 32, 42, 63, 64, 67, 77, 97,133,134,137,147,167,202,202,202,
+    202, 11, 12, 13, 15, 16, 18, 30, 31, 33, 43, 65, 66, 68, 78, 98,135,
+    136,138,148,168,203,203,203,203, 12, 13, 14, 16, 17, 19, 31, 32, 34,
+     44, 66, 67, 69, 79, 99,136,137,139,149,169,204,204,204,204, 15, 16,
+     17, 18, 19, 20, 33, 34, 35, 45, 68, 69, 70, 80,100,138,139,140,150,
+    170,205,205,205,205, 21, 22, 23, 26, 27, 30, 36, 37, 40, 46, 71, 72,
+     75, 81,101,141,142,145,151,171,206,206,206,206, 22, 23, 24, 27, 28,
+     31, 37, 38, 41, 47, 72, 73, 76, 82,102,142,143,146,152,172,207,207,
+    207,207, 23, 24, 25, 28, 29, 32, 38, 39, 42, 48, 73, 74, 77, 83,103,
+    143,144,147,153,173,208,208,208,208, 26, 27, 28, 30, 31, 33, 40, 41,
+     43, 49, 75, 76, 78, 84,104,145,146,148,154,174,209,209,209,209, 27,
+     28, 29, 31, 32, 34, 41, 42, 44, 50, 76, 77, 79, 85,105,146,147,149,
+    155,175,210,210,210,210, 30, 31, 32, 33, 34, 35, 43, 44, 45, 51, 78,
+     79, 80, 86,106,148,149,150,156,176,211,211,211,211, 36, 37, 38, 40,
+     41, 43, 46, 47, 49, 52, 81, 82, 84, 87,107,151,152,154,157,177,212,
+    212,212,212, 37, 38, 39, 41, 42, 44, 47, 48, 50, 53, 82, 83, 85, 88,
+    108,152,153,155,158,178,213,213,213,213, 40, 41, 42, 43, 44, 45, 49,
+     50, 51, 54, 84, 85, 86, 89,109,154,155,156,159,179,214,214,214,214,
+     46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 87, 88, 89, 90,110,157,158,
+    159,160,180,215,215,215,215, 56, 57, 58, 61, 62, 65, 71, 72, 75, 81,
+     91, 92, 95,101,111,161,162,165,171,181,216,216,216,216, 57, 58, 59,
+     62, 63, 66, 72, 73, 76, 82, 92, 93, 96,102,112,162,163,166,172,182,
+    217,217,217,217, 58, 59, 60, 63, 64, 67, 73, 74, 77, 83, 93, 94, 97,
+    103,113,163,164,167,173,183,218,218,218,218, 61, 62, 63, 65, 66, 68,
+     75, 76, 78, 84, 95, 96, 98,104,114,165,166,168,174,184,219,219,219,
+    219, 62, 63, 64, 66, 67, 69, 76, 77, 79, 85, 96, 97, 99,105,115,166,
+    167,169,175,185,220,220,220,220, 65, 66, 67, 68, 69, 70, 78, 79, 80,
+     86, 98, 99,100,106,116,168,169,170,176,186,221,221,221,221, 71, 72,
+     73, 75, 76, 78, 81, 82, 84, 87,101,102,104,107,117,171,172,174,177,
+    187,222,222,222,222, 72, 73, 74, 76, 77, 79, 82, 83, 85, 88,102,103,
+    105,108,118,172,173,175,178,188,223,223,223,223, 75, 76, 77, 78, 79,
+     80, 84, 85, 86, 89,104,105,106,109,119,174,175,176,179,189,224,224,
+    224,224, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,107,108,109,110,120,
+    177,178,179,180,190,225,225,225,225, 91, 92, 93, 95, 96, 98,101,102,
+    104,107,111,112,114,117,121,181,182,184,187,191,226,226,226,226, 92,
+     93, 94, 96, 97, 99,102,103,105,108,112,113,115,118,122,182,183,185,
+    188,192,227,227,227,227, 95, 96, 97, 98, 99,100,104,105,106,109,114,
+    115,116,119,123,184,185,186,189,193,228,228,228,228,101,102,103,104,
+    105,106,107,108,109,110,117,118,119,120,124,187,188,189,190,194,229,
+    229,229,229,111,112,113,114,115,116,117,118,119,120,121,122,123,124,
+    125,191,192,193,194,195,230,230,230,230,126,127,128,131,132,135,141,
+    142,145,151,161,162,165,171,181,196,197,200,206,216,231,231,231,231,
+    127,128,129,132,133,136,142,143,146,152,162,163,166,172,182,197,198,
+    201,207,217,232,232,232,232,128,129,130,133,134,137,143,144,147,153,
+    163,164,167,173,183,198,199,202,208,218,233,233,233,233,131,132,133,
+    135,136,138,145,146,148,154,165,166,168,174,184,200,201,203,209,219,
+    234,234,234,234,132,133,134,136,137,139,146,147,149,155,166,167,169,
+    175,185,201,202,204,210,220,235,235,235,235,135,136,137,138,139,140,
+    148,149,150,156,168,169,170,176,186,203,204,205,211,221,236,236,236,
+    236,141,142,143,145,146,148,151,152,154,157,171,172,174,177,187,206,
+    207,209,212,222,237,237,237,237,142,143,144,146,147,149,152,153,155,
+    158,172,173,175,178,188,207,208,210,213,223,238,238,238,238,145,146,
+    147,148,149,150,154,155,156,159,174,175,176,179,189,209,210,211,214,
+    224,239,239,239,239,151,152,153,154,155,156,157,158,159,160,177,178,
+    179,180,190,212,213,214,215,225,240,240,240,240,161,162,163,165,166,
+    168,171,172,174,177,181,182,184,187,191,216,217,219,222,226,241,241,
+    241,241,162,163,164,166,167,169,172,173,175,178,182,183,185,188,192,
+    217,218,220,223,227,242,242,242,242,165,166,167,168,169,170,174,175,
+    176,179,184,185,186,189,193,219,220,221,224,228,243,243,243,243,171,
+    172,173,174,175,176,177,178,179,180,187,188,189,190,194,222,223,224,
+    225,229,244,244,244,244,181,182,183,184,185,186,187,188,189,190,191,
+    192,193,194,195,226,227,228,229,230,245,245,245,245,196,197,198,200,
+    201,203,206,207,209,212,216,217,219,222,226,231,232,234,237,241,246,
+    246,246,246,197,198,199,201,202,204,207,208,210,213,217,218,220,223,
+    227,232,233,235,238,242,247,247,247,247,200,201,202,203,204,205,209,
+    210,211,214,219,220,221,224,228,234,235,236,239,243,248,248,248,248,
+    206,207,208,209,210,211,212,213,214,215,222,223,224,225,229,237,238,
+    239,240,244,249,249,249,249,216,217,218,219,220,221,222,223,224,225,
+    226,227,228,229,230,241,242,243,244,245,250,250,250,250,231,232,233,
+    234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,
+    251,251,251,251,  0,  1,  6, 21, 56,126,126,126,  1,  2,  7, 22, 57,
+    127,127,127,  2,  3,  8, 23, 58,128,128,128,  3,  4,  9, 24, 59,129,
+    129,129,  4,  5, 10, 25, 60,130,130,130,  6,  7, 11, 26, 61,131,131,
+    131,  7,  8, 12, 27, 62,132,132,132,  8,  9, 13, 28, 63,133,133,133,
+      9, 10, 14, 29, 64,134,134,134, 11, 12, 15, 30, 65,135,135,135, 12,
+     13, 16, 31, 66,136,136,136, 13, 14, 17, 32, 67,137,137,137, 15, 16,
+     18, 33, 68,138,138,138, 16, 17, 19, 34, 69,139,139,139, 18, 19, 20,
+     35, 70,140,140,140, 21, 22, 26, 36, 71,141,141,141, 22, 23, 27, 37,
+     72,142,142,142, 23, 24, 28, 38, 73,143,143,143, 24, 25, 29, 39, 74,
+    144,144,144, 26, 27, 30, 40, 75,145,145,145, 27, 28, 31, 41, 76,146,
+    146,146, 28, 29, 32, 42, 77,147,147,147, 30, 31, 33, 43, 78,148,148,
+    148, 31, 32, 34, 44, 79,149,149,149, 33, 34, 35, 45, 80,150,150,150,
+     36, 37, 40, 46, 81,151,151,151, 37, 38, 41, 47, 82,152,152,152, 38,
+     39, 42, 48, 83,153,153,153, 40, 41, 43, 49, 84,154,154,154, 41, 42,
+     44, 50, 85,155,155,155, 43, 44, 45, 51, 86,156,156,156, 46, 47, 49,
+     52, 87,157,157,157, 47, 48, 50, 53, 88,158,158,158, 49, 50, 51, 54,
+     89,159,159,159, 52, 53, 54, 55, 90,160,160,160, 56, 57, 61, 71, 91,
+    161,161,161, 57, 58, 62, 72, 92,162,162,162, 58, 59, 63, 73, 93,163,
+    163,163, 59, 60, 64, 74, 94,164,164,164, 61, 62, 65, 75, 95,165,165,
+    165, 62, 63, 66, 76, 96,166,166,166, 63, 64, 67, 77, 97,167,167,167,
+     65, 66, 68, 78, 98,168,168,168, 66, 67, 69, 79, 99,169,169,169, 68,
+     69, 70, 80,100,170,170,170, 71, 72, 75, 81,101,171,171,171, 72, 73,
+     76, 82,102,172,172,172, 73, 74, 77, 83,103,173,173,173, 75, 76, 78,
+     84,104,174,174,174, 76, 77, 79, 85,105,175,175,175, 78, 79, 80, 86,
+    106,176,176,176, 81, 82, 84, 87,107,177,177,177, 82, 83, 85, 88,108,
+    178,178,178, 84, 85, 86, 89,109,179,179,179, 87, 88, 89, 90,110,180,
+    180,180, 91, 92, 95,101,111,181,181,181, 92, 93, 96,102,112,182,182,
+    182, 93, 94, 97,103,113,183,183,183, 95, 96, 98,104,114,184,184,184,
+     96, 97, 99,105,115,185,185,185, 98, 99,100,106,116,186,186,186,101,
+    102,104,107,117,187,187,187,102,103,105,108,118,188,188,188,104,105,
+    106,109,119,189,189,189,107,108,109,110,120,190,190,190,111,112,114,
+    117,121,191,191,191,112,113,115,118,122,192,192,192,114,115,116,119,
+    123,193,193,193,117,118,119,120,124,194,194,194,121,122,123,124,125,
+    195,195,195,126,127,131,141,161,196,196,196,127,128,132,142,162,197,
+    197,197,128,129,133,143,163,198,198,198,129,130,134,144,164,199,199,
+    199,131,132,135,145,165,200,200,200,132,133,136,146,166,201,201,201,
+    133,134,137,147,167,202,202,202,135,136,138,148,168,203,203,203,136,
+    137,139,149,169,204,204,204,138,139,140,150,170,205,205,205,141,142,
+    145,151,171,206,206,206,142,143,146,152,172,207,207,207,143,144,147,
+    153,173,208,208,208,145,146,148,154,174,209,209,209,146,147,149,155,
+    175,210,210,210,148,149,150,156,176,211,211,211,151,152,154,157,177,
+    212,212,212,152,153,155,158,178,213,213,213,154,155,156,159,179,214,
+    214,214,157,158,159,160,180,215,215,215,161,162,165,171,181,216,216,
+    216,162,163,166,172,182,217,217,217,163,164,167,173,183,218,218,218,
+    165,166,168,174,184,219,219,219,166,167,169,175,185,220,220,220,168,
+    169,170,176,186,221,221,221,171,172,174,177,187,222,222,222,172,173,
+    175,178,188,223,223,223,174,175,176,179,189,224,224,224,177,178,179,
+    180,190,225,225,225,181,182,184,187,191,226,226,226,182,183,185,188,
+    192,227,227,227,184,185,186,189,193,228,228,228,187,188,189,190,194,
+    229,229,229,191,192,193,194,195,230,230,230,196,197,200,206,216,231,
+    231,231,197,198,201,207,217,232,232,232,198,199,202,208,218,233,233,
+    233,200,201,203,209,219,234,234,234,201,202,204,210,220,235,235,235,
+    203,204,205,211,221,236,236,236,206,207,209,212,222,237,237,237,207,
+    208,210,213,223,238,238,238,209,210,211,214,224,239,239,239,212,213,
+    214,215,225,240,240,240,216,217,219,222,226,241,241,241,217,218,220,
+    223,227,242,242,242,219,220,221,224,228,243,243,243,222,223,224,225,
+    229,244,244,244,226,227,228,229,230,245,245,245,231,232,234,237,241,
+    246,246,246,232,233,235,238,242,247,247,247,234,235,236,239,243,248,
+    248,248,237,238,239,240,244,249,249,249,241,242,243,244,245,250,250,
+    250,246,247,248,249,250,251,251,251,  0,  0,  0,  0,  1,  1,  1,  1,
+      2,  2,  2,  2,  3,  3,  3,  3,  4,  4,  4,  4,  5,  5,  5,  5,  6,
+      6,  6,  6,  7,  7,  7,  7,  8,  8,  8,  8,  9,  9,  9,  9, 10, 10,
+     10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14,
+     14, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18,
+     19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23,
+     23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27,
+     27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31,
+     31, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35,
+     36, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 40,
+     40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 42, 43, 43, 43, 43, 44, 44,
+     44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 47, 48, 48, 48,
+     48, 49, 49, 49, 49, 50, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52, 52,
+     53, 53, 53, 53, 54, 54, 54, 54, 55, 55, 55, 55, 56, 56, 56, 56, 57,
+     57, 57, 57, 58, 58, 58, 58, 59, 59, 59, 59, 60, 60, 60, 60, 61, 61,
+     61, 61, 62, 62, 62, 62, 63, 63, 63, 63, 64, 64, 64, 64, 65, 65, 65,
+     65, 66, 66, 66, 66, 67, 67, 67, 67, 68, 68, 68, 68, 69, 69, 69, 69,
+     70, 70, 70, 70, 71, 71, 71, 71, 72, 72, 72, 72, 73, 73, 73, 73, 74,
+     74, 74, 74, 75, 75, 75, 75, 76, 76, 76, 76, 77, 77, 77, 77, 78, 78,
+     78, 78, 79, 79, 79, 79, 80, 80, 80, 80, 81, 81, 81, 81, 82, 82, 82,
+     82, 83, 83, 83, 83, 84, 84, 84, 84, 85, 85, 85, 85, 86, 86, 86, 86,
+     87, 87, 87, 87, 88, 88, 88, 88, 89, 89, 89, 89, 90, 90, 90, 90, 91,
+     91, 91, 91, 92, 92, 92, 92, 93, 93, 93, 93, 94, 94, 94, 94, 95, 95,
+     95, 95, 96, 96, 96, 96, 97, 97, 97, 97, 98, 98, 98, 98, 99, 99, 99,
+     99,100,100,100,100,101,101,101,101,102,102,102,102,103,103,103,103,
+    104,104,104,104,105,105,105,105,106,106,106,106,107,107,107,107,108,
+    108,108,108,109,109,109,109,110,110,110,110,111,111,111,111,112,112,
+    112,112,113,113,113,113,114,114,114,114,115,115,115,115,116,116,116,
+    116,117,117,117,117,118,118,118,118,119,119,119,119,120,120,120,120,
+    121,121,121,121,122,122,122,122,123,123,123,123,124,124,124,124,125,
+    125,125,125,126,126,126,126,127,127,127,127,128,128,128,128,129,129,
+    129,129,130,130,130,130,131,131,131,131,132,132,132,132,133,133,133,
+    133,134,134,134,134,135,135,135,135,136,136,136,136,137,137,137,137,
+    138,138,138,138,139,139,139,139,140,140,140,140,141,141,141,141,142,
+    142,142,142,143,143,143,143,144,144,144,144,145,145,145,145,146,146,
+    146,146,147,147,147,147,148,148,148,148,149,149,149,149,150,150,150,
+    150,151,151,151,151,152,152,152,152,153,153,153,153,154,154,154,154,
+    155,155,155,155,156,156,156,156,157,157,157,157,158,158,158,158,159,
+    159,159,159,160,160,160,160,161,161,161,161,162,162,162,162,163,163,
+    163,163,164,164,164,164,165,165,165,165,166,166,166,166,167,167,167,
+    167,168,168,168,168,169,169,169,169,170,170,170,170,171,171,171,171,
+    172,172,172,172,173,173,173,173,174,174,174,174,175,175,175,175,176,
+    176,176,176,177,177,177,177,178,178,178,178,179,179,179,179,180,180,
+    180,180,181,181,181,181,182,182,182,182,183,183,183,183,184,184,184,
+    184,185,185,185,185,186,186,186,186,187,187,187,187,188,188,188,188,
+    189,189,189,189,190,190,190,190,191,191,191,191,192,192,192,192,193,
+    193,193,193,194,194,194,194,195,195,195,195,196,196,196,196,197,197,
+    197,197,198,198,198,198,199,199,199,199,200,200,200,200,201,201,201,
+    201,202,202,202,202,203,203,203,203,204,204,204,204,205,205,205,205,
+    206,206,206,206,207,207,207,207,208,208,208,208,209,209,209,209,210,
+    210,210,210,211,211,211,211,212,212,212,212,213,213,213,213,214,214,
+    214,214,215,215,215,215,216,216,216,216,217,217,217,217,218,218,218,
+    218,219,219,219,219,220,220,220,220,221,221,221,221,222,222,222,222,
+    223,223,223,223,224,224,224,224,225,225,225,225,226,226,226,226,227,
+    227,227,227,228,228,228,228,229,229,229,229,230,230,230,230,231,231,
+    231,231,232,232,232,232,233,233,233,233,234,234,234,234,235,235,235,
+    235,236,236,236,236,237,237,237,237,238,238,238,238,239,239,239,239,
+    240,240,240,240,241,241,241,241,242,242,242,242,243,243,243,243,244,
+    244,244,244,245,245,245,245,246,246,246,246,247,247,247,247,248,248,
+    248,248,249,249,249,249,250,250,250,250,251,251,251,251,
+};
+
+double const transitionodds[transition_entrycount]
+    __attribute__((aligned(32))) = {
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.16666666666666666,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.055555555555555552,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.027777777777777776,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.013888888888888888,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.018518518518518517,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0092592592592592587,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0046296296296296294,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0030864197530864196,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0007716049382716049,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.015432098765432098,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.007716049382716049,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0038580246913580245,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0025720164609053498,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.0012860082304526749,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.00064300411522633745,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+    0.0001286008230452675,
+};
@@ -0,0 +1,99 @@
+/* tables.h: Precomputed lookup tables.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _tables_h_
+#define _tables_h_
+
+/* The tables declared here are generated by the mktables program at
+ * build time, and so they all live in read-only memory.
+ *
+ * Every distinct hand of five dice has an index, from 0 to 251, and
+ * every distinct set of zero to five dice (i.e., the dice that can be
+ * kept from a hand before rerolling the rest) has a keep index, from
+ * 0 to 461. The index of a hand is found by mapping its low nine bits
+ * and its high nine bits to two partial indexes and adding them
+ * together. (The index arrays are padded so that they can be read
+ * with 32-bit vector gathers.)
+ */
+#define	hand_count		252
+#define	keep_count		462
+
+/* The index of a hand of five dice, and the keep index of a set of
+ * zero to five dice.
+ */
+#define	handindex(h)		(handlowindices[(h) & 0777] + \
+				 handhighindices[(h) >> 9])
+#define	keepindex(h)		(keeplowindices[(h) & 0777] + \
+				 keephighindices[(h) >> 9])
+
+/* The tables mapping the halves of a hand to partial indexes.
+ */
+extern unsigned char const handlowindices[512 + 3];
+extern unsigned char const handhighindices[512 + 3];
+extern unsigned short const keeplowindices[512];
+extern unsigned short const keephighindices[512];
+
+/* The hand for each hand index, and the set of dice for each keep
+ * index.
+ */
+extern hand const handlist[hand_count];
+extern hand const keeplist[keep_count];
+
+/* The dice of each hand, in ascending order.
+ */
+extern unsigned char const handdice[hand_count][ctl_dice_count];
+
+/* The score that each hand earns in each slot, in the same order as
+ * the slot controls. Zero is stored for the output-only slots. Each
+ * hand's scores fill 16 bytes, and the table is aligned so that no
+ * hand straddles a cache line.
+ */
+extern unsigned char const handscores[hand_count][ctl_slots_count];
+
+/* The keep index of the dice kept from each hand, for every possible
+ * keep mask. Bit n of the mask corresponds to the nth die of the
+ * hand in ascending order (i.e., the dice in handdice).
+ */
+extern unsigned short const keepindices[hand_count][1 << ctl_dice_count];
+
+/* The number of dice in each keep.
+ */
+extern unsigned char const keepsizes[keep_count];
+
+/* The probability of rolling exactly the dice in each keep, when
+ * rolling as many dice as it contains.
+ */
+extern double const rollodds[keep_count];
+
+/* The transition matrix, which gives for each keep the hands that
+ * can result from rolling the other dice, and the probability of
+ * each. The keeps are divided into blocks by the number of dice
+ * rolled, from zero to five, so that every row within a block has
+ * the same length (1, 6, 21, 56, 126, or 252 entries). Each block's
+ * row count is padded to a multiple of four by repeating its last
+ * row, and its entries are stored column by column, so that the
+ * rows can be evaluated four at a time. The rows of block b run
+ * from transitionrowstart[b] up to transitionrowstart[b + 1], and
+ * its entries from transitionentrystart[b] up to
+ * transitionentrystart[b + 1]. Within each row, the entries are in
+ * the order of the keep indexes of the dice rolled.
+ */
+#define	transition_blockcount	(ctl_dice_count + 1)
+#define	transition_rowcount	472
+#define	transition_entrycount	5556
+
+/* The first row and the first entry of each block of the transition
+ * matrix, the keep index of each row, and the hand index and the
+ * probability of each entry.
+ */
+extern unsigned short const transitionrowstart[transition_blockcount + 1];
+extern unsigned short const
+			transitionentrystart[transition_blockcount + 1];
+extern unsigned short const transitionkeeps[transition_rowcount];
+extern unsigned char const transitionhands[transition_entrycount];
+extern double const transitionodds[transition_entrycount];
+
+#endif
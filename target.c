@@ -0,0 +1,446 @@
+/* target.c: The strategy for reaching a target score.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "yahtzee.h"
+#include "gen.h"
+#include "hand.h"
+#include "tables.h"
+#include "transitions.h"
+#include "solver.h"
+#include "target.h"
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define TARGET_SIMD
+#include <immintrin.h>
+#endif
+
+/* The solver works on vectors holding a probability for each number
+ * of points needed, which are padded to a multiple of eight entries.
+ * The longest vector is for the start of the game, when up to 375
+ * points can be scored.
+ */
+#define	maxvectorsize		376
+
+/* The most points that can be scored in one turn, which is 30 in an
+ * upper category plus the bonus.
+ */
+#define	maxturnpoints		65
+
+/* The highest score in each category.
+ */
+static int const categorymax[category_count] = {
+    5, 10, 15, 20, 25, 30, 30, 30, 25, 30, 40, 50, 30
+};
+
+/* The position of each state's entries in a target table.
+ */
+static unsigned int targetoffsets[state_count + 1];
+
+/* For each hand, the distinct keeps that can be made from it, as in
+ * the solver.
+ */
+#define	handkeep_count		4368
+static int handkeepstart[hand_count + 1];
+static unsigned short handkeeps[handkeep_count];
+
+/* The probability of each hand on a roll of all five dice.
+ */
+static double handodds[hand_count];
+
+/* The vectors used while solving one state. These take over a
+ * megabyte, which is too much for a thread's stack on some systems,
+ * so they are allocated for each mask instead.
+ */
+struct targetbuffers {
+    float successors[category_count][ctl_dice_count + 1]
+		    [maxturnpoints + 1 + maxvectorsize];
+    float hands[hand_count][maxvectorsize];
+    float keeps[keep_count][maxvectorsize];
+};
+
+/* Pointers to the selected implementations of accumulate() and
+ * maximize().
+ */
+static void (*accumulate)(float *sums, float weight, float const *values,
+			  int count);
+static void (*maximize)(float *best, float const *values, int count);
+
+/*
+ * The implementations of the vector operations. The vectors are
+ * always a multiple of eight entries long.
+ */
+
+/* Add a vector times a weight to a running sum, one entry at a time.
+ */
+static void scalar_accumulate(float *sums, float weight,
+			      float const *values, int count)
+{
+    int n;
+
+    for (n = 0 ; n < count ; ++n)
+	sums[n] += weight * values[n];
+}
+
+/* Replace each entry of a vector with the larger of it and another
+ * vector's entry, one entry at a time.
+ */
+static void scalar_maximize(float *best, float const *values, int count)
+{
+    int n;
+
+    for (n = 0 ; n < count ; ++n)
+	if (best[n] < values[n])
+	    best[n] = values[n];
+}
+
+#ifdef TARGET_SIMD
+
+/* Add a vector times a weight to a running sum, eight entries at a
+ * time. (As elsewhere, the upper halves of the registers are cleared
+ * explicitly before returning.)
+ */
+__attribute__((target("avx")))
+static void avx_accumulate(float *sums, float weight,
+			   float const *values, int count)
+{
+    __m256 w;
+    int n;
+
+    w = _mm256_set1_ps(weight);
+    for (n = 0 ; n < count ; n += 8)
+	_mm256_storeu_ps(sums + n,
+			 _mm256_add_ps(_mm256_loadu_ps(sums + n),
+				       _mm256_mul_ps(w,
+						_mm256_loadu_ps(values + n))));
+    _mm256_zeroupper();
+}
+
+/* Take the larger of the entries of two vectors, eight at a time.
+ */
+__attribute__((target("avx")))
+static void avx_maximize(float *best, float const *values, int count)
+{
+    int n;
+
+    for (n = 0 ; n < count ; n += 8)
+	_mm256_storeu_ps(best + n, _mm256_max_ps(_mm256_loadu_ps(best + n),
+						 _mm256_loadu_ps(values + n)));
+    _mm256_zeroupper();
+}
+
+#endif
+
+/*
+ * Initialization.
+ */
+
+/* Return the most points that can still be scored from a state.
+ */
+static int targettop(int mask, int subtotal)
+{
+    int top, upper, c;
+
+    top = upper = 0;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	top += categorymax[c];
+	if (c < 6)
+	    upper += categorymax[c];
+    }
+    if (subtotal < 63 && subtotal + upper >= 63)
+	top += 35;
+    return top;
+}
+
+/* Lay out the table, with entries only for the states that can occur
+ * in a game, and build the lists of keeps and select the
+ * implementations of the vector operations.
+ */
+static void buildtargets(void)
+{
+    int h, mask, state, k, n, i;
+
+    inittransitions();
+    targetoffsets[0] = 0;
+    for (state = 0 ; state < state_count ; ++state) {
+	mask = state / subtotal_count;
+	targetoffsets[state + 1] = targetoffsets[state];
+	if (isreachable(mask, state % subtotal_count))
+	    targetoffsets[state + 1] += targettop(mask, state % subtotal_count);
+    }
+
+    n = 0;
+    for (h = 0 ; h < hand_count ; ++h) {
+	handkeepstart[h] = n;
+	for (mask = 0 ; mask < 1 << ctl_dice_count ; ++mask) {
+	    k = keepindices[h][mask];
+	    for (i = handkeepstart[h] ; i < n ; ++i)
+		if (handkeeps[i] == k)
+		    break;
+	    if (i == n)
+		handkeeps[n++] = k;
+	}
+	handodds[h] = rollodds[keepindex(handlist[h])];
+    }
+    handkeepstart[hand_count] = n;
+
+    accumulate = scalar_accumulate;
+    maximize = scalar_maximize;
+#ifdef TARGET_SIMD
+    if (__builtin_cpu_supports("avx")) {
+	accumulate = avx_accumulate;
+	maximize = avx_maximize;
+    }
+#endif
+}
+
+/* Build the tables the first time they are needed. Any thread may
+ * get here first, so the others wait until the tables are complete.
+ */
+static void inittargets(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, buildtargets);
+}
+
+/*
+ * Solving the table.
+ */
+
+/* Find the points scored by putting a number of dice in an upper
+ * category, including the bonus if it is earned, and the new
+ * subtotal.
+ */
+static int upperpoints(int c, int n, int subtotal, int *next)
+{
+    int score;
+
+    score = (c + 1) * n;
+    *next = subtotal + score;
+    if (*next >= 63) {
+	*next = 63;
+	if (subtotal < 63)
+	    score += 35;
+    }
+    return score;
+}
+
+/* Fill in the vector of probabilities for a state that can follow
+ * the current one. The vector is preceded by enough entries of one
+ * (for needing zero or fewer points) that it can be read starting
+ * from any number of points earned on the way to the state.
+ */
+static void readsuccessor(unsigned short const *table, int mask,
+			  int subtotal, int count, float *vector)
+{
+    unsigned int offset;
+    int top, n;
+
+    for (n = 0 ; n <= maxturnpoints ; ++n)
+	vector[n] = 1.0f;
+    vector += maxturnpoints + 1;
+    offset = targetoffsets[stateindex(mask, subtotal)];
+    top = targettop(mask, subtotal);
+    for (n = 0 ; n < count ; ++n)
+	vector[n] = n < top ? table[offset + n] / 65535.0f : 0.0f;
+}
+
+/* Compute every probability for one state. This is the same as
+ * solving for the expected score, except that each value is now a
+ * vector, with one entry for each number of points needed.
+ */
+static void solvetargetstate(struct targetbuffers *buffers,
+			     unsigned short *table, int mask, int subtotal)
+{
+    float (*successors)[ctl_dice_count + 1]
+		       [maxturnpoints + 1 + maxvectorsize] = buffers->successors;
+    float (*hands)[maxvectorsize] = buffers->hands;
+    float (*keeps)[maxvectorsize] = buffers->keeps;
+    float sums[maxvectorsize];
+    unsigned int offset;
+    int top, count, c, n, next, points, h, k, i, entry, stride, rerolls, q;
+
+    top = targettop(mask, subtotal);
+    count = (top + 7) & ~7;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	if (c >= 6) {
+	    readsuccessor(table, mask | (1 << c), subtotal, count,
+			  successors[c][0]);
+	    continue;
+	}
+	for (n = 0 ; n <= ctl_dice_count ; ++n) {
+	    upperpoints(c, n, subtotal, &next);
+	    readsuccessor(table, mask | (1 << c), next, count,
+			  successors[c][n]);
+	}
+    }
+
+    for (h = 0 ; h < hand_count ; ++h) {
+	memset(hands[h], 0, count * sizeof **hands);
+	for (c = 0 ; c < category_count ; ++c) {
+	    if (mask & (1 << c))
+		continue;
+	    if (c < 6) {
+		n = handcount(handlist[h], c);
+		points = upperpoints(c, n, subtotal, &next);
+	    } else {
+		n = 0;
+		points = handscores[h][categoryslots[c] - ctl_slots];
+	    }
+	    maximize(hands[h], successors[c][n] + maxturnpoints + 1 - points,
+		     count);
+	}
+    }
+
+    for (rerolls = 0 ; rerolls < 2 ; ++rerolls) {
+	for (k = 0 ; k < keep_count ; ++k) {
+	    memset(keeps[k], 0, count * sizeof **keeps);
+	    for (n = transitionrow(k, &entry, &stride) ; n ;
+							--n, entry += stride)
+		accumulate(keeps[k], transitionodds[entry],
+			   hands[transitionhands[entry]], count);
+	}
+	for (h = 0 ; h < hand_count ; ++h) {
+	    i = handkeepstart[h];
+	    memcpy(hands[h], keeps[handkeeps[i]], count * sizeof **hands);
+	    for (++i ; i < handkeepstart[h + 1] ; ++i)
+		maximize(hands[h], keeps[handkeeps[i]], count);
+	}
+    }
+
+    memset(sums, 0, count * sizeof *sums);
+    for (h = 0 ; h < hand_count ; ++h)
+	accumulate(sums, handodds[h], hands[h], count);
+    offset = targetoffsets[stateindex(mask, subtotal)];
+    for (n = 0 ; n < top ; ++n) {
+	q = (int)(sums[n] * 65535.0f + 0.5f);
+	table[offset + n] = q > 65535 ? 65535 : q;
+    }
+}
+
+/* Solve all of the states for one category mask.
+ */
+static void solvetargetmask(void *data, int mask)
+{
+    struct targetbuffers *buffers;
+    int subtotal;
+
+    if (mask == categorymask_count - 1)
+	return;
+    buffers = allocate(sizeof *buffers);
+    for (subtotal = 0 ; subtotal < subtotal_count ; ++subtotal)
+	if (isreachable(mask, subtotal))
+	    solvetargetstate(buffers, data, mask, subtotal);
+    free(buffers);
+}
+
+/*
+ * Choosing moves.
+ */
+
+/* Compute the probability of reaching the target from a hand at the
+ * end of a turn, which is the best choice of open category. The best
+ * category is stored in category.
+ */
+static double targethandvalue(unsigned short const *table, int mask,
+			      int subtotal, int points, int h, int *category)
+{
+    double best, value;
+    int c, score, next;
+
+    best = 0.0;
+    *category = -1;
+    for (c = 0 ; c < category_count ; ++c) {
+	if (mask & (1 << c))
+	    continue;
+	if (c < 6) {
+	    score = upperpoints(c, handcount(handlist[h], c), subtotal, &next);
+	} else {
+	    score = handscores[h][categoryslots[c] - ctl_slots];
+	    next = subtotal;
+	}
+	value = targetodds(table, mask | (1 << c), next, points - score);
+	if (*category < 0 || best < value) {
+	    best = value;
+	    *category = c;
+	}
+    }
+    return best;
+}
+
+/*
+ * Exported functions.
+ */
+
+/* The size of the table is fixed by its layout.
+ */
+unsigned int targetentrycount(void)
+{
+    inittargets();
+    return targetoffsets[state_count];
+}
+
+/* Solve every turn-start state, one layer at a time.
+ */
+unsigned short *solvetargets(int threadcount, FILE *log)
+{
+    unsigned short *table;
+
+    inittargets();
+    table = allocate(targetentrycount() * sizeof *table);
+    solvelayers(threadcount, solvetargetmask, NULL, table, log);
+    return table;
+}
+
+/* Look up a single probability.
+ */
+double targetodds(unsigned short const *table, int mask, int subtotal,
+		  int points)
+{
+    inittargets();
+    if (points <= 0)
+	return 1.0;
+    if (points > targettop(mask, subtotal))
+	return 0.0;
+    return table[targetoffsets[stateindex(mask, subtotal)] + points - 1]
+	 / 65535.0;
+}
+
+/* Compute the value of each hand at the end of the turn, and let the
+ * solver pick the keep.
+ */
+int choosetargetkeep(unsigned short const *table, int mask, int subtotal,
+		     int points, unsigned char const *dice, int rerolls)
+{
+    double hands[hand_count];
+    int h, c;
+
+    inittargets();
+    for (h = 0 ; h < hand_count ; ++h)
+	hands[h] = targethandvalue(table, mask, subtotal, points, h, &c);
+    return choosekeepbyvalue(hands, dice, rerolls);
+}
+
+/* Pick the category that gives the dice the best probability.
+ */
+int choosetargetcategory(unsigned short const *table, int mask,
+			 int subtotal, int points, unsigned char const *dice)
+{
+    int category;
+
+    inittargets();
+    targethandvalue(table, mask, subtotal, points, sortdice(dice, NULL),
+		    &category);
+    return category;
+}
@@ -0,0 +1,53 @@
+/* target.h: The strategy for reaching a target score.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _target_h_
+#define _target_h_
+
+/* Instead of maximizing the expected score, a player can try to
+ * maximize the probability of finishing with at least a given score.
+ * The best move then depends on how many more points are needed, so
+ * a target table holds, for every turn-start state and every number
+ * of points from one up to the most that can still be scored from
+ * that state, the probability of scoring at least that many points
+ * under the best play. Needing no points at all is certain, and
+ * needing more than the most that can be scored is hopeless, so
+ * neither is stored. Each probability is quantized to 16 bits.
+ */
+
+/* The number of entries in a target table.
+ */
+extern unsigned int targetentrycount(void);
+
+/* Compute a target table. The return value is newly allocated. The
+ * arguments are as for solvegame().
+ */
+extern unsigned short *solvetargets(int threadcount, FILE *log);
+
+/* Return the probability, according to a target table, of scoring at
+ * least the given number of points during the rest of the game from
+ * a turn-start state.
+ */
+extern double targetodds(unsigned short const *table,
+			 int mask, int subtotal, int points);
+
+/* Choose which dice to keep in order to score at least the given
+ * number of points during the rest of the game. The other arguments
+ * and the return value are as for choosekeep().
+ */
+extern int choosetargetkeep(unsigned short const *table, int mask,
+			    int subtotal, int points,
+			    unsigned char const *dice, int rerolls);
+
+/* Choose which open category to score a roll in, in order to score
+ * at least the given number of points during the rest of the game.
+ * Returns -1 if every category has been used.
+ */
+extern int choosetargetcategory(unsigned short const *table, int mask,
+				int subtotal, int points,
+				unsigned char const *dice);
+
+#endif
@@ -0,0 +1,231 @@
+/* transitions.c: Evaluating the transition matrix.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#include <string.h>
+#include <pthread.h>
+#include "yahtzee.h"
+#include "hand.h"
+#include "tables.h"
+#include "transitions.h"
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define TRANSITIONS_SIMD
+#include <immintrin.h>
+#endif
+
+/* Pointer to the selected implementation of expectkeeps().
+ */
+void (*expectkeeps)(double const *handvalues, double *keepvalues);
+
+/* The largest number of rows in a block of the transition matrix.
+ */
+#define	maxblockrows	252
+
+/* The row of the transition matrix for each keep, and the block that
+ * contains it.
+ */
+static short keeprows[keep_count];
+static unsigned char keepblocks[keep_count];
+
+/*
+ * The implementations of expectkeeps().
+ */
+
+/* Walk down each column of a block in turn, adding its terms to the
+ * running sums of every row in the block.
+ */
+static void scalar_expectkeeps(double const *handvalues, double *keepvalues)
+{
+    double sums[maxblockrows];
+    int block, rowstart, rowcount, entry, end, row;
+
+    for (block = 0 ; block < transition_blockcount ; ++block) {
+	rowstart = transitionrowstart[block];
+	rowcount = transitionrowstart[block + 1] - rowstart;
+	end = transitionentrystart[block + 1];
+	for (row = 0 ; row < rowcount ; ++row)
+	    sums[row] = 0.0;
+	for (entry = transitionentrystart[block] ; entry < end ;
+							entry += rowcount)
+	    for (row = 0 ; row < rowcount ; ++row)
+		sums[row] += transitionodds[entry + row]
+			   * handvalues[transitionhands[entry + row]];
+	for (row = 0 ; row < rowcount ; ++row)
+	    keepvalues[transitionkeeps[rowstart + row]] = sums[row];
+    }
+}
+
+#ifdef TRANSITIONS_SIMD
+
+/* Compute the rows two at a time, one in each half of a register.
+ */
+__attribute__((target("sse2")))
+static void sse2_expectkeeps(double const *handvalues, double *keepvalues)
+{
+    double sums[2] __attribute__((aligned(16)));
+    __m128d sum, values;
+    int block, rowstart, rowcount, entry, end, row;
+
+    for (block = 0 ; block < transition_blockcount ; ++block) {
+	rowstart = transitionrowstart[block];
+	rowcount = transitionrowstart[block + 1] - rowstart;
+	end = transitionentrystart[block + 1];
+	for (row = 0 ; row < rowcount ; row += 2) {
+	    sum = _mm_setzero_pd();
+	    for (entry = transitionentrystart[block] + row ; entry < end ;
+							entry += rowcount) {
+		values = _mm_set_pd(handvalues[transitionhands[entry + 1]],
+				    handvalues[transitionhands[entry]]);
+		sum = _mm_add_pd(sum,
+				 _mm_mul_pd(_mm_load_pd(transitionodds + entry),
+					    values));
+	    }
+	    _mm_store_pd(sums, sum);
+	    keepvalues[transitionkeeps[rowstart + row]] = sums[0];
+	    keepvalues[transitionkeeps[rowstart + row + 1]] = sums[1];
+	}
+    }
+}
+
+/* Compute the rows four at a time, gathering the hand values for
+ * each column of four entries with a single instruction. Two groups
+ * of rows are computed together where possible, so that the gathers
+ * can overlap. (The upper halves of the registers are cleared before
+ * returning, since gcc does not do so when optimizing for size, and
+ * leaving them dirty slows down any SSE code that runs afterwards.)
+ */
+__attribute__((target("avx2")))
+static void avx2_expectkeeps(double const *handvalues, double *keepvalues)
+{
+    double sums[8] __attribute__((aligned(32)));
+    __m256d sum0, sum1;
+    __m128i hands0, hands1;
+    unsigned int packed[2];
+    int block, rowstart, rowcount, entry, end, row, n;
+
+    for (block = 0 ; block < transition_blockcount ; ++block) {
+	rowstart = transitionrowstart[block];
+	rowcount = transitionrowstart[block + 1] - rowstart;
+	end = transitionentrystart[block + 1];
+	for (row = 0 ; row + 8 <= rowcount ; row += 8) {
+	    sum0 = _mm256_setzero_pd();
+	    sum1 = _mm256_setzero_pd();
+	    for (entry = transitionentrystart[block] + row ; entry < end ;
+							entry += rowcount) {
+		memcpy(packed, transitionhands + entry, sizeof packed);
+		hands0 = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed[0]));
+		hands1 = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed[1]));
+		sum0 = _mm256_add_pd(sum0,
+			_mm256_mul_pd(_mm256_load_pd(transitionodds + entry),
+				      _mm256_i32gather_pd(handvalues,
+							  hands0, 8)));
+		sum1 = _mm256_add_pd(sum1,
+			_mm256_mul_pd(_mm256_load_pd(transitionodds + entry
+								   + 4),
+				      _mm256_i32gather_pd(handvalues,
+							  hands1, 8)));
+	    }
+	    _mm256_store_pd(sums, sum0);
+	    _mm256_store_pd(sums + 4, sum1);
+	    for (n = 0 ; n < 8 ; ++n)
+		keepvalues[transitionkeeps[rowstart + row + n]] = sums[n];
+	}
+	if (row < rowcount) {
+	    sum0 = _mm256_setzero_pd();
+	    for (entry = transitionentrystart[block] + row ; entry < end ;
+							entry += rowcount) {
+		memcpy(packed, transitionhands + entry, sizeof *packed);
+		hands0 = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed[0]));
+		sum0 = _mm256_add_pd(sum0,
+			_mm256_mul_pd(_mm256_load_pd(transitionodds + entry),
+				      _mm256_i32gather_pd(handvalues,
+							  hands0, 8)));
+	    }
+	    _mm256_store_pd(sums, sum0);
+	    for (n = 0 ; n < 4 ; ++n)
+		keepvalues[transitionkeeps[rowstart + row + n]] = sums[n];
+	}
+    }
+    _mm256_zeroupper();
+}
+
+#endif
+
+/*
+ * Initialization.
+ */
+
+/* Find the row of each keep, and select the fastest implementation
+ * of expectkeeps(). (The matrix itself is generated at build time.)
+ * Where a row is repeated as padding, the first copy is used.
+ */
+static void buildtransitions(void)
+{
+    int block, row;
+
+    for (block = 0 ; block < transition_blockcount ; ++block) {
+	for (row = transitionrowstart[block + 1] - 1 ;
+	     row >= transitionrowstart[block] ; --row) {
+	    keeprows[transitionkeeps[row]] = row;
+	    keepblocks[transitionkeeps[row]] = block;
+	}
+    }
+    if (!selecttransitions(transitions_avx2) &&
+			!selecttransitions(transitions_sse2))
+	selecttransitions(transitions_scalar);
+}
+
+/*
+ * Exported functions.
+ */
+
+/* The solvers each call this when they set up, possibly from several
+ * threads at once, so the work is only done by the first caller.
+ */
+void inittransitions(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, buildtransitions);
+}
+
+/* Locate a keep's row within its block.
+ */
+int transitionrow(int keep, int *first, int *stride)
+{
+    int block;
+
+    block = keepblocks[keep];
+    *stride = transitionrowstart[block + 1] - transitionrowstart[block];
+    *first = transitionentrystart[block] + keeprows[keep]
+					 - transitionrowstart[block];
+    return (transitionentrystart[block + 1] - transitionentrystart[block])
+	 / *stride;
+}
+
+/* Choose the implementation of expectkeeps(), if the CPU supports it.
+ */
+int selecttransitions(int method)
+{
+    switch (method) {
+      case transitions_scalar:
+	expectkeeps = scalar_expectkeeps;
+	return 1;
+#ifdef TRANSITIONS_SIMD
+      case transitions_sse2:
+	if (!__builtin_cpu_supports("sse2"))
+	    return 0;
+	expectkeeps = sse2_expectkeeps;
+	return 1;
+      case transitions_avx2:
+	if (!__builtin_cpu_supports("avx2"))
+	    return 0;
+	expectkeeps = avx2_expectkeeps;
+	return 1;
+#endif
+    }
+    return 0;
+}
@@ -0,0 +1,43 @@
+/* transitions.h: Evaluating the transition matrix.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _transitions_h_
+#define _transitions_h_
+
+/* The list of available implementations of expectkeeps().
+ */
+enum {
+    transitions_scalar, transitions_sse2, transitions_avx2,
+    transitions_count
+};
+
+/* Select the fastest implementation of expectkeeps() that the CPU
+ * supports, and prepare transitionrow(). Only the first call does
+ * anything, and it is safe to call from several threads at once.
+ */
+extern void inittransitions(void);
+
+/* Select a specific implementation of expectkeeps(). Returns false
+ * if the implementation is not available on this machine.
+ */
+extern int selecttransitions(int method);
+
+/* Given a value for every hand (indexed by hand index), compute the
+ * expected value of every keep (indexed by keep index), which is the
+ * average value of the hands that rolling the rest of the dice can
+ * produce. All of the implementations add up the terms in the same
+ * order, and so produce identical results.
+ */
+extern void (*expectkeeps)(double const *handvalues, double *keepvalues);
+
+/* Find the entries of the transition matrix in the row for a keep.
+ * The return value is the number of entries. The first entry is
+ * stored in first, and each entry after it is stride entries further
+ * on.
+ */
+extern int transitionrow(int keep, int *first, int *stride);
+
+#endif
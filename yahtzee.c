@@ -7,24 +7,28 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <time.h>
+#include <unistd.h>
 #include "yahtzee.h"
 #include "gen.h"
 #include "scoring.h"
+#include "solver.h"
+#include "distribution.h"
+#include "target.h"
+#include "solution.h"
+#include "advisor.h"
+#include "rng.h"
+#include "policy.h"
+#include "simulate.h"
+#include "engine.h"
+#include "server.h"
 #include "io.h"
 
-/* Macros for changing the control flags.
+/* The source of the dice rolls, and the seed it was given.
  */
-#define setselected(control)	((control).flags |= ctlflag_selected)
-#define clearselected(control)	((control).flags &= ~ctlflag_selected)
-#define flipselected(control)	((control).flags ^= ctlflag_selected)
-#define setdisabled(control)	((control).flags |= ctlflag_disabled)
-#define cleardisabled(control)	((control).flags &= ~ctlflag_disabled)
-#define setmodified(control)	((control).flags |= ctlflag_modified)
-
-/* The array of I/O controls.
- */
-struct control controls[ctl_count];
+static struct rng dicerng;
+static unsigned long long seed;
 
 /* Version, copyright, and license text.
  */
@@ -74,280 +78,461 @@ char const *rulesinfo[] = {
 };
 
 /*
- * I/O control management.
+ * main().
  */
 
-/* Put the controls in their initial states and set their hotkeys.
+/* Select an interface to initialize depending on compiler settings
+ * and the user environment.
  */
-static void initcontrols(void)
+static void initui(struct game *game)
 {
-    int i;
+#if defined INCLUDE_SDL
+#if defined unix
+    if (!getenv("DISPLAY"))
+	goto skipsdl;
+#endif
+    if (initializeio(io_sdl, game))
+	return;
+    skipsdl:
+#endif
+#if defined INCLUDE_CURSES
+    if (getenv("TERM"))
+	if (initializeio(io_curses, game))
+	    return;
+#endif
+    initializeio(io_text, game);
+}
 
-    for (i = 0 ; i < ctl_count ; ++i) {
-	controls[i].value = -1;
-	cleardisabled(controls[i]);
-	clearselected(controls[i]);
-	clearmodified(controls[i]);
-    }
+static void printtext(char const *lines[])
+{
+    char const *line;
+    int i, n;
 
-    controls[ctl_die_0].key = 'a';
-    controls[ctl_die_1].key = 'b';
-    controls[ctl_die_2].key = 'c';
-    controls[ctl_die_3].key = 'd';
-    controls[ctl_die_4].key = 'e';
-    controls[ctl_button].key = ' ';
-    controls[ctl_slot_ones].key = '1';
-    controls[ctl_slot_twos].key = '2';
-    controls[ctl_slot_threes].key = '3';
-    controls[ctl_slot_fours].key = '4';
-    controls[ctl_slot_fives].key = '5';
-    controls[ctl_slot_sixes].key = '6';
-    controls[ctl_slot_threeofakind].key = 't';
-    controls[ctl_slot_fourofakind].key = 'f';
-    controls[ctl_slot_fullhouse].key = 'h';
-    controls[ctl_slot_smallstraight].key = 's';
-    controls[ctl_slot_largestraight].key = 'l';
-    controls[ctl_slot_yahtzee].key = 'y';
-    controls[ctl_slot_chance].key = 'x';
+    for (i = 0 ; lines[i] ; ++i) {
+	line = lines[i];
+	while (*line) {
+	    n = textbreak(&line, 72);
+	    printf("%.*s\n", n, line);
+	    line += n;
+	}
+    }
 }
 
-/* Unmark and roll all of the dice.
+/* Compute the optimal strategy and save it to a file, from which it
+ * will be loaded the next time the game is played. If threadcount is
+ * zero, one thread is used for each available processor.
  */
-static void rollalldice(void)
+static int runsolver(char const *filename, int threadcount)
 {
-    int i;
+    float *table;
+
+    if (threadcount <= 0)
+	threadcount = sysconf(_SC_NPROCESSORS_ONLN);
+    table = solvegame(threadcount, stdout);
+    printf("Expected score under optimal play: %.4f\n", table[0]);
+    if (!savesolution(filename, table)) {
+	perror(filename);
+	return EXIT_FAILURE;
+    }
+    free(table);
+    return 0;
+}
 
-    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
-	cleardisabled(controls[i]);
-	clearselected(controls[i]);
-	controls[i].value = (int)((rand() * 6.0) / (double)RAND_MAX);
-	setmodified(controls[i]);
+/* Compute the distribution of the final score under optimal play
+ * and save it to a file, using the saved solution if there is one.
+ * A summary of the distribution at the start of the game is
+ * displayed.
+ */
+static int rundistribution(char const *filename, int threadcount)
+{
+    static int const percentiles[] = { 1, 5, 10, 25, 50, 75, 90, 95, 99 };
+    struct distributiontable *table;
+    float *computed = NULL;
+    double mean, cdf, prev;
+    int points, i;
+
+    if (threadcount <= 0)
+	threadcount = sysconf(_SC_NPROCESSORS_ONLN);
+    if (!loadsolution(solutionpath())) {
+	printf("Computing the optimal strategy first.\n");
+	computed = solvegame(threadcount, stdout);
+    }
+    table = solvedistributions(computed ? computed : solution,
+			       threadcount, stdout);
+    mean = prev = 0.0;
+    for (points = 0 ; points <= maxscore ; ++points) {
+	cdf = scorecdf(table, 0, 0, points);
+	mean += points * (cdf - prev);
+	prev = cdf;
+    }
+    printf("Mean score under optimal play: %.4f\n", mean);
+    printf("Percentiles:");
+    for (i = 0 ; i < (int)(sizeof percentiles / sizeof *percentiles) ; ++i)
+	printf(" %d%%:%d", percentiles[i],
+	       scorequantile(table, 0, 0, percentiles[i] / 100.0));
+    printf("\n%u probabilities stored\n", table->cdfcount);
+    if (!savedistributions(filename, table)) {
+	perror(filename);
+	return EXIT_FAILURE;
     }
-    updateopenslots();
+    free(table);
+    free(computed);
+    return 0;
 }
 
-/* Reroll the dice that are currently selected.
+/* Display the fraction of games under optimal play that end with a
+ * lower score than the given one.
  */
-static void rolldice(void)
+static int runpercentile(char const *score)
 {
-    int i;
+    int points;
 
-    for (i = ctl_dice ; i < ctl_dice_end ; ++i) {
-	if (isselected(controls[i])) {
-	    clearselected(controls[i]);
-	    controls[i].value = (int)((rand() * 6.0) / (double)RAND_MAX);
-	    setmodified(controls[i]);
-	}
+    points = atoi(score);
+    if (points < 0 || points > maxscore) {
+	fprintf(stderr, "%s: score must be between 0 and %d\n",
+		score, maxscore);
+	return EXIT_FAILURE;
     }
-    updateopenslots();
+    if (!loaddistributions(distributionpath())) {
+	fprintf(stderr, "no distribution file; run yahtzee --distribution\n");
+	return EXIT_FAILURE;
+    }
+    printf("A score of %d beats %.2f%% of games under optimal play.\n",
+	   points, 100.0 * scorecdf(distributions, 0, 0, points - 1));
+    return 0;
 }
 
-/* Mark the dice as fixed.
+/* Compute the strategies for reaching every target score and save
+ * them to a file, from which they will be loaded when a game is
+ * played with a target.
  */
-static void freezedice(void)
+static int runtargets(char const *filename, int threadcount)
 {
+    static int const scores[] = { 150, 200, 250, 300, 350 };
+    unsigned short *table;
     int i;
 
-    for (i = ctl_dice ; i < ctl_dice_end ; ++i)
-	setdisabled(controls[i]);
+    if (threadcount <= 0)
+	threadcount = sysconf(_SC_NPROCESSORS_ONLN);
+    table = solvetargets(threadcount, stdout);
+    printf("Chance of reaching a score when playing for it:");
+    for (i = 0 ; i < (int)(sizeof scores / sizeof *scores) ; ++i)
+	printf(" %d:%.2f%%", scores[i],
+	       100.0 * targetodds(table, 0, 0, scores[i]));
+    printf("\n");
+    if (!savetargets(filename, table)) {
+	perror(filename);
+	return EXIT_FAILURE;
+    }
+    free(table);
+    return 0;
 }
 
-/* Erase the scores in all of the slots.
+/* Print the statistics of a set of final scores: the mean and
+ * spread, some percentiles, and how often the bonus and a Yahtzee
+ * were scored.
  */
-static void clearallslots(void)
+static void printsimstats(struct simstats const *stats)
 {
+    static double const fractions[] = {
+	0.01, 0.05, 0.25, 0.50, 0.75, 0.95, 0.99
+    };
     int i;
 
-    for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
-	controls[i].value = -1;
-	clearselected(controls[i]);
-	if (controls[i].key)
-	    cleardisabled(controls[i]);
-	else
-	    setdisabled(controls[i]);
-    }
+    printf("Mean score: %.3f  standard deviation: %.3f"
+	   "  lowest: %d  highest: %d\n",
+	   simmean(stats), sqrt(simvariance(stats)),
+	   stats->lowest, stats->highest);
+    printf("Percentiles:");
+    for (i = 0 ; i < (int)(sizeof fractions / sizeof *fractions) ; ++i)
+	printf("  %.0f%%: %d", 100.0 * fractions[i],
+	       simpercentile(stats, fractions[i]));
+    printf("\nBonus: %.2f%% of games  Yahtzee: %.2f%% of games\n",
+	   100.0 * stats->bonuses / stats->games,
+	   100.0 * stats->yahtzees / stats->games);
 }
 
-/*
- * The main loop.
+/* Print the average score in each slot, in the same layout as the
+ * score card.
  */
+static void printslotaverages(struct simstats const *stats)
+{
+    static char const *names[ctl_slots_count] = {
+	"Ones", "Twos", "Threes", "Fours", "Fives", "Sixes",
+	"Subtotal", "Bonus", "3 of a kind", "4 of a kind", "Full house",
+	"Sm. straight", "Lg. straight", "Yahtzee", "Chance", "Total"
+    };
+    int n, m;
+
+    m = ctl_slot_threeofakind - ctl_slots;
+    for (n = 0 ; n < m ; ++n) {
+	printf("%-13s %7.3f", names[n],
+	       (double)stats->slottotals[n] / stats->games);
+	if (m + n < ctl_slots_count)
+	    printf("    %-13s %7.3f", names[m + n],
+		   (double)stats->slottotals[m + n] / stats->games);
+	putchar('\n');
+    }
+}
 
-/* Run a single session of the game. Returns true if the game ran to
- * completion, or false if the user quit. This function embodies the
- * game's state machine. Each iteration of the main loop has three
- * stages: one, update the controls to indicate the game's current
- * state; two, retrieve input from the user; and three, apply the
- * user's action to the game state.
+/* Find a policy by name, or list the policies if there is no such
+ * built-in policy. (A plugin that fails to load has already reported
+ * why.)
  */
-static int playgame(void)
+static struct policy const *getpolicy(char const *name)
 {
-    struct control *control;
-    struct control *selectedslot;
-    int slotopencount, rollcount;
-    int ctl, i;
-
-    clearallslots();
-    rollalldice();
-    rollcount = 1;
-
-    for (;;) {
-	selectedslot = 0;
-	slotopencount = 0;
-	for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
-	    if (!isdisabled(controls[i]))
-		++slotopencount;
-	    if (isselected(controls[i]))
-		selectedslot = &controls[i];
-	}
-	if (slotopencount == 0) {
-	    updatescores();
-	    break;
-	}
-	if (rollcount == 3 || selectedslot) {
-	    controls[ctl_button].value = bval_score;
-	    if (selectedslot)
-		cleardisabled(controls[ctl_button]);
-	    else
-		setdisabled(controls[ctl_button]);
-	    if (rollcount == 3)
-		freezedice();
-	} else {
-	    controls[ctl_button].value = bval_roll;
-	    setdisabled(controls[ctl_button]);
-	    for (i = ctl_dice ; i < ctl_dice_end ; ++i)
-		if (isselected(controls[i]))
-		    cleardisabled(controls[ctl_button]);
-	}
+    struct policy const *policy;
+    int i;
 
-	getnextevent:
-	if (rollcount == 3 && slotopencount == 1) {
-	    if (selectedslot) {
-		ctl = ctl_button;
-	    } else {
-		for (i = ctl_slots ; i < ctl_slots_end ; ++i) {
-		    if (!isdisabled(controls[i])) {
-			ctl = i;
-			break;
-		    }
-		}
-	    }
-	} else {
-	    if (!runio(&ctl))
-		return 0;
-	}
-	control = &controls[ctl];
-	if (isdisabled(*control))
-	    goto getnextevent;
-
-	if (ctl >= ctl_dice && ctl < ctl_dice_end) {
-	    if (rollcount == 3)
-		goto getnextevent;
-	    flipselected(*control);
-	    if (selectedslot) {
-		clearselected(*selectedslot);
-		setmodified(*selectedslot);
-		updatescores();
-	    }
-	    continue;
-	}
-	if (ctl >= ctl_slots && ctl < ctl_slots_end) {
-	    if (isdisabled(*control))
-		goto getnextevent;
-	    setselected(*control);
-	    setmodified(*control);
-	    if (selectedslot) {
-		clearselected(*selectedslot);
-		setmodified(*selectedslot);
-	    }
-	    for (i = ctl_dice ; i < ctl_dice_end ; ++i)
-		clearselected(controls[i]);
-	    updatescores();
-	    continue;
-	}
-	if (ctl == ctl_button) {
-	    if (control->value == bval_score) {
-		if (!selectedslot) {
-		    setdisabled(*control);
-		    goto getnextevent;
-		}
-		setdisabled(*selectedslot);
-		clearselected(*selectedslot);
-		setmodified(*selectedslot);
-		if (slotopencount > 1) {
-		    rollalldice();
-		    rollcount = 1;
-		}
-	    } else {
-		if (rollcount == 3) {
-		    setdisabled(*control);
-		    goto getnextevent;
-		}
-		rolldice();
-		++rollcount;
-	    }
-	    continue;
-	}
+    policy = findpolicy(name);
+    if (!policy && !ispluginname(name)) {
+	fprintf(stderr, "%s: unknown policy; the policies are:\n", name);
+	for (i = 0 ; policies[i] ; ++i)
+	    fprintf(stderr, "  %-10s %s\n", policies[i]->name,
+		    policies[i]->description);
     }
-
-    return 1;
+    return policy;
 }
 
-/* Handle I/O inbetween games. Returns true if the user asked to start
- * another session. The button is the only active control.
+/* Make sure that the solution is available if any of the policies
+ * need it.
  */
-static int newgame(void)
+static void preparepolicies(struct policy const *const *chosen, int count,
+			    int threadcount)
 {
-    int ctl;
+    int i;
 
-    controls[ctl_button].value = bval_newgame;
-    cleardisabled(controls[ctl_button]);
-    for (;;) {
-	if (!runio(&ctl))
-	    return 0;
-	if (ctl == ctl_button)
-	    return 1;
+    for (i = 0 ; i < count ; ++i)
+	if (!strcmp(chosen[i]->name, "optimal"))
+	    break;
+    if (i < count && !loadsolution(solutionpath())) {
+	printf("Computing the optimal strategy first.\n");
+	solution = solvegame(threadcount, NULL);
     }
 }
 
-/*
- * main().
+/* Play games with a policy, without the user interface, and report
+ * the results. With --versus, play the same games with a second
+ * policy, and report the difference between them with a 95%
+ * confidence interval, along with how many more games it would take
+ * to get the same interval from independent dice.
  */
+static int runsimulation(int argc, char *argv[])
+{
+    struct simcomparison results;
+    struct policy const *chosen[2];
+    unsigned long long games;
+    char const *name, *versusname;
+    FILE *log;
+    double mean, variance;
+    int threadcount, i;
+
+    games = strtoull(argv[2], NULL, 10);
+    name = "optimal";
+    versusname = NULL;
+    threadcount = 0;
+    for (i = 3 ; i + 1 < argc ; i += 2) {
+	if (!strcmp(argv[i], "--policy"))
+	    name = argv[i + 1];
+	else if (!strcmp(argv[i], "--versus"))
+	    versusname = argv[i + 1];
+	else if (!strcmp(argv[i], "--threads"))
+	    threadcount = atoi(argv[i + 1]);
+	else
+	    break;
+    }
+    if (i != argc || !games) {
+	fputs("Usage: yahtzee --simulate N [--policy P] [--versus P]"
+	      " [--threads N]\n", stderr);
+	return EXIT_FAILURE;
+    }
+    chosen[0] = getpolicy(name);
+    if (!chosen[0])
+	return EXIT_FAILURE;
+    if (versusname) {
+	chosen[1] = getpolicy(versusname);
+	if (!chosen[1])
+	    return EXIT_FAILURE;
+    }
+    if (threadcount <= 0)
+	threadcount = sysconf(_SC_NPROCESSORS_ONLN);
+    preparepolicies(chosen, versusname ? 2 : 1, threadcount);
+
+    log = isatty(fileno(stderr)) ? stderr : NULL;
+    if (!versusname) {
+	simulate(chosen[0], games, threadcount, seed, &results.stats[0], log);
+	printf("Played %llu games with the %s policy in %.3f sec"
+	       " using %d thread%s\n", results.stats[0].games, chosen[0]->name,
+	       results.stats[0].seconds,
+	       threadcount, threadcount == 1 ? "" : "s");
+	printf("Games per second: %.0f (seed %llu)\n",
+	       results.stats[0].games / results.stats[0].seconds, seed);
+	printsimstats(&results.stats[0]);
+	printslotaverages(&results.stats[0]);
+	return 0;
+    }
 
-/* Select an interface to initialize depending on compiler settings
- * and the user environment.
+    comparepolicies(chosen, 2, games, threadcount, seed, &results, log);
+    printf("Played %llu games each with the %s and %s policies on the"
+	   " same dice in %.3f sec using %d thread%s\n",
+	   results.stats[0].games, chosen[0]->name, chosen[1]->name,
+	   results.stats[0].seconds,
+	   threadcount, threadcount == 1 ? "" : "s");
+    printf("Games per second: %.0f (seed %llu)\n",
+	   2 * results.stats[0].games / results.stats[0].seconds, seed);
+    for (i = 0 ; i < 2 ; ++i) {
+	printf("With the %s policy:\n", chosen[i]->name);
+	printsimstats(&results.stats[i]);
+    }
+    mean = simdiffmean(&results, 0, 1);
+    variance = simdiffvariance(&results, 0, 1);
+    printf("Difference (%s - %s): %.3f +/- %.3f (95%% confidence)\n",
+	   chosen[0]->name, chosen[1]->name, mean,
+	   1.96 * sqrt(variance / results.stats[0].games));
+    printf("Won by %s: %llu  by %s: %llu  tied: %llu\n",
+	   chosen[0]->name, results.wins[0][1],
+	   chosen[1]->name, results.wins[1][0],
+	   results.stats[0].games - results.wins[0][1] - results.wins[1][0]);
+    if (variance > 0.0)
+	printf("Independent dice would need %.1f times as many games for"
+	       " the same precision\n",
+	       (simvariance(&results.stats[0])
+			+ simvariance(&results.stats[1])) / variance);
+    return 0;
+}
+
+/* Play games with several policies on the same dice, and display
+ * them ranked by their mean score. Each policy's mean is shown with a
+ * 95% confidence interval, and so is the amount by which it trails
+ * the leader, which is much narrower since it compares the scores
+ * game by game. The time per decision and the games per second are
+ * measured in a single thread.
  */
-static void initui(void)
+static int runtournament(int argc, char *argv[])
 {
-#if defined INCLUDE_SDL
-#if defined unix
-    if (!getenv("DISPLAY"))
-	goto skipsdl;
-#endif
-    if (initializeio(io_sdl))
-	return;
-    skipsdl:
-#endif
-#if defined INCLUDE_CURSES
-    if (getenv("TERM"))
-	if (initializeio(io_curses))
-	    return;
-#endif
-    initializeio(io_text);
+    struct simcomparison results;
+    struct policy const *chosen[maxpolicies];
+    unsigned long long games;
+    struct simstats const *stats;
+    char *names, *name;
+    int order[maxpolicies];
+    int threadcount, count, leader, i, j, n;
+
+    games = strtoull(argv[2], NULL, 10);
+    names = NULL;
+    threadcount = 0;
+    for (i = 3 ; i + 1 < argc ; i += 2) {
+	if (!strcmp(argv[i], "--policies"))
+	    names = argv[i + 1];
+	else if (!strcmp(argv[i], "--threads"))
+	    threadcount = atoi(argv[i + 1]);
+	else
+	    break;
+    }
+    if (i != argc || !games) {
+	fputs("Usage: yahtzee --tournament N [--policies P,P,...]"
+	      " [--threads N]\n", stderr);
+	return EXIT_FAILURE;
+    }
+    count = 0;
+    if (names) {
+	for (name = strtok(names, ",") ; name ; name = strtok(NULL, ",")) {
+	    if (count == maxpolicies) {
+		fprintf(stderr, "at most %d policies can play at once\n",
+			maxpolicies);
+		return EXIT_FAILURE;
+	    }
+	    chosen[count] = getpolicy(name);
+	    if (!chosen[count++])
+		return EXIT_FAILURE;
+	}
+    } else {
+	for (count = 0 ; policies[count] && count < maxpolicies ; ++count)
+	    chosen[count] = policies[count];
+    }
+    if (threadcount <= 0)
+	threadcount = sysconf(_SC_NPROCESSORS_ONLN);
+    preparepolicies(chosen, count, threadcount);
+
+    comparepolicies(chosen, count, games, threadcount, seed, &results,
+		    isatty(fileno(stderr)) ? stderr : NULL);
+
+    for (i = 0 ; i < count ; ++i) {
+	for (j = i ; j > 0 && results.stats[order[j - 1]].sum
+					< results.stats[i].sum ; --j)
+	    order[j] = order[j - 1];
+	order[j] = i;
+    }
+    leader = order[0];
+    printf("Played %llu games with each of %d policies on the same dice"
+	   " in %.3f sec\nusing %d thread%s (seed %llu)\n\n",
+	   games, count, results.stats[0].seconds,
+	   threadcount, threadcount == 1 ? "" : "s", seed);
+    printf("Rank  Policy        Mean score     Behind leader"
+	   "   Won vs leader  usec/decision  Games/sec\n");
+    for (n = 0 ; n < count ; ++n) {
+	i = order[n];
+	stats = &results.stats[i];
+	printf("%4d  %-10s %7.2f +/-%5.2f",
+	       n + 1, chosen[i]->name, simmean(stats),
+	       1.96 * sqrt(simvariance(stats) / stats->games));
+	if (i == leader)
+	    printf("          --             --  ");
+	else
+	    printf("  %7.2f +/-%5.2f  %12.2f%%",
+		   simdiffmean(&results, leader, i),
+		   1.96 * sqrt(simdiffvariance(&results, leader, i)
+			       / stats->games),
+		   100.0 * results.wins[i][leader] / stats->games);
+	printf("  %13.3f %10.0f\n",
+	       1e6 * stats->playtime / stats->decisions,
+	       stats->games / stats->playtime);
+    }
+    return 0;
 }
 
-static void printtext(char const *lines[])
+/* Play games with clients over a socket. Hints are only given if the
+ * solution has been computed.
+ */
+static int runserve(int argc, char *argv[])
 {
-    char const *line;
-    int i, n;
+    int threadcount;
 
-    for (i = 0 ; lines[i] ; ++i) {
-	line = lines[i];
-	while (*line) {
-	    n = textbreak(&line, 72);
-	    printf("%.*s\n", n, line);
-	    line += n;
-	}
+    threadcount = 0;
+    if (argc == 5 && !strcmp(argv[3], "--threads")) {
+	threadcount = atoi(argv[4]);
+    } else if (argc != 3) {
+	fputs("Usage: yahtzee --serve SOCKET [--threads N]\n", stderr);
+	return EXIT_FAILURE;
     }
+    if (threadcount <= 0)
+	threadcount = sysconf(_SC_NPROCESSORS_ONLN);
+    initscoring();
+    loadsolution(solutionpath());
+    return runserver(argv[2], threadcount, seed);
+}
+
+/* Find the arguments of one of the commands that compute a table,
+ * which are an optional filename and an optional thread count, in
+ * either order. Anything else that starts with "--" is not taken as
+ * a filename. Returns false if the arguments are not valid.
+ */
+static int parsesolveargs(int argc, char *argv[],
+			  char const **filename, int *threadcount)
+{
+    int named, i;
+
+    *threadcount = 0;
+    named = 0;
+    for (i = 2 ; i < argc ; ++i) {
+	if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+	    *threadcount = atoi(argv[++i]);
+	else if (!strncmp(argv[i], "--", 2) || named++)
+	    return 0;
+	else
+	    *filename = argv[i];
+    }
+    return 1;
 }
 
 /* Run the program.
@@ -359,8 +544,42 @@ int main(int argc, char *argv[])
 	"       yahtzee --help      to display this help.\n"
 	"       yahtzee --version   to display version and license.\n"
 	"       yahtzee --rules     to display rules of the game.\n"
+	"       yahtzee --solve [FILE] [--threads N]\n"
+	"                           to compute the optimal strategy.\n"
+	"       yahtzee --distribution [FILE] [--threads N]\n"
+	"                           to compute the distribution of scores.\n"
+	"       yahtzee --percentile SCORE\n"
+	"                           to rank a final score.\n"
+	"       yahtzee --solve-targets [FILE] [--threads N]\n"
+	"                           to compute the strategies for reaching\n"
+	"                           each target score.\n"
+	"       yahtzee --verify    to check the saved files for damage.\n"
+	"       yahtzee --target SCORE\n"
+	"                           to play with hints that aim for SCORE.\n"
+	"       yahtzee --simulate N [--policy P] [--versus P] [--threads N]\n"
+	"                           to play N games without a display.\n"
+	"       yahtzee --tournament N [--policies P,P,...] [--threads N]\n"
+	"                           to rank policies over N games.\n"
+	"       yahtzee --serve SOCKET [--threads N]\n"
+	"                           to host games on a Unix domain socket.\n"
+	"Any of the commands that play games also accept --seed N, to\n"
+	"make the dice repeatable.\n"
 	"\n"
 	"While the game is running, press ? or F1 for assistance.\n";
+    struct game game;
+    char const *filename;
+    int threadcount, ctl, i;
+
+    seed = time(0);
+    for (i = 1 ; i < argc - 1 ; ++i) {
+	if (!strcmp(argv[i], "--seed")) {
+	    seed = strtoull(argv[i + 1], NULL, 0);
+	    memmove(argv + i, argv + i + 2, (argc - i - 1) * sizeof *argv);
+	    argc -= 2;
+	    break;
+	}
+    }
+    rngseed(&dicerng, seed, 0);
 
     if (argc == 2) {
 	if (!strcmp(argv[1], "--help")) {
@@ -372,18 +591,51 @@ int main(int argc, char *argv[])
 	} else if (!strcmp(argv[1], "--rules")) {
 	    printtext(rulesinfo);
 	    return 0;
+	} else if (!strcmp(argv[1], "--verify")) {
+	    return verifyfiles() ? 0 : EXIT_FAILURE;
 	}
     }
-    if (argc > 1) {
+    if (argc == 3 && !strcmp(argv[1], "--percentile"))
+	return runpercentile(argv[2]);
+    if (argc > 1 && !strcmp(argv[1], "--solve")) {
+	filename = solutionpath();
+	if (parsesolveargs(argc, argv, &filename, &threadcount))
+	    return runsolver(filename, threadcount);
+    }
+    if (argc > 1 && !strcmp(argv[1], "--distribution")) {
+	filename = distributionpath();
+	if (parsesolveargs(argc, argv, &filename, &threadcount))
+	    return rundistribution(filename, threadcount);
+    }
+    if (argc > 1 && !strcmp(argv[1], "--solve-targets")) {
+	filename = targetpath();
+	if (parsesolveargs(argc, argv, &filename, &threadcount))
+	    return runtargets(filename, threadcount);
+    }
+    if (argc > 2 && !strcmp(argv[1], "--simulate"))
+	return runsimulation(argc, argv);
+    if (argc > 2 && !strcmp(argv[1], "--tournament"))
+	return runtournament(argc, argv);
+    if (argc > 2 && !strcmp(argv[1], "--serve"))
+	return runserve(argc, argv);
+    if (argc == 3 && !strcmp(argv[1], "--target")) {
+	if (!loadtargets(targetpath()) && !loaddistributions(distributionpath()))
+	    fprintf(stderr, "no target table; run yahtzee --solve-targets\n");
+	setobjective(objective_targetscore, atoi(argv[2]));
+    } else if (argc > 1) {
 	fputs(yowzitch, stderr);
 	return EXIT_FAILURE;
     }
 
-    srand(time(0));
-    initcontrols();
+    srand(time(0));		/* only for animating the dice */
+    game.rng = &dicerng;
+    initcontrols(&game);
     initscoring();
-    initui();
+    loadsolution(solutionpath());
+    initui(&game);
 
-    while (playgame() && newgame()) ;
+    startgame(&game);
+    while (runio(&ctl))
+	step(&game, ctl);
     return 0;
 }
@@ -40,6 +40,11 @@
 #define	ctl_slots_end		(ctl_slots + ctl_slots_count) 
 #define	ctl_count		(ctl_slots_end)
 
+/* A pseudo-control ID that the user interface returns when the user
+ * asks for a hint. It has no entry in the array of controls.
+ */
+#define	ctl_hint		(ctl_count)
+
 /* Possible values for the button control. Each value corresponds to a
  * different button label.
  */
@@ -65,9 +70,23 @@ struct control {
 
 #define clearmodified(control)	((control).flags &= ~ctlflag_modified)
 
-/* The array of I/O controls.
+/* The state of a game in progress. The user interface sees the game
+ * only through the I/O controls; the rest is kept up to date by the
+ * game logic and the scoring code. Nothing else is shared between
+ * games, so any number of them can be played at once. The source of
+ * the dice is a struct rng (see rng.h), which is not owned by the
+ * game and can be shared between games played by the same thread.
  */
-extern struct control controls[ctl_count];
+struct game {
+    struct control controls[ctl_count];	/* the I/O controls */
+    struct rng *rng;			/* the source of the dice rolls */
+    int rollcount;			/* the dice rolls so far this turn */
+    unsigned int currenthand;		/* the hand showing on the dice */
+    int currentdice[ctl_dice_count];	/* the dice it was taken from */
+    int uppertotal, lowertotal;		/* the totals of the used slots */
+    int upperusedcount, lowerusedcount;	/* the number of used slots */
+    int selectedslot;			/* the selected slot, or -1 */
+};
 
 /* Null-terminated array of paragraphs, giving the program's version
  * number, copyright, and license.
@@ -0,0 +1,67 @@
+/* yahtzeebot.h: The interface for policies loaded from plugins.
+ *
+ * Copyright (C) 2010 Brian Raiter.
+ * This program is free software. See README for details.
+ */
+
+#ifndef _yahtzeebot_h_
+#define _yahtzeebot_h_
+
+/* A plugin is a shared object that defines a function named
+ * yahtzeebot, taking no arguments and returning a pointer to a
+ * struct yahtzeebot that stays valid for as long as the plugin is
+ * loaded. This header is all that a plugin needs; it does not link
+ * against anything in the program. The interface will only change
+ * along with the version number, and the program refuses to load a
+ * plugin that was built for a different version.
+ */
+#define	yahtzeebot_version	1
+
+/* The state of a game when a choice has to be made is packed into a
+ * 64-bit number:
+ *
+ * bits 0-14:  the five dice, three bits each, as faces 0 to 5
+ * bits 15-16: the number of rerolls left in the turn, 0 to 2
+ * bits 17-29: the categories used so far (see below)
+ * bits 30-35: the upper section's subtotal, capped at 63
+ * bits 36-45: the total score so far
+ *
+ * The rest of the bits are zero. The categories are numbered from 0
+ * to 12: ones through sixes, three of a kind, four of a kind, full
+ * house, small straight, large straight, Yahtzee, and chance.
+ */
+#define	yb_die(state, i)	((int)((state) >> ((i) * 3)) & 7)
+#define	yb_rerolls(state)	((int)((state) >> 15) & 3)
+#define	yb_mask(state)		((int)((state) >> 17) & 0x1FFF)
+#define	yb_subtotal(state)	((int)((state) >> 30) & 63)
+#define	yb_score(state)		((int)((state) >> 36) & 1023)
+
+#define	yb_dice_count		5
+#define	yb_category_count	13
+
+/* The functions that make up a policy. Each thread that plays games
+ * with the policy creates its own player with newplayer(), which is
+ * given a seed for any random choices the player makes, and passes
+ * it to the other functions; so a player is never used by two
+ * threads at once. newplayer() and freeplayer() may be NULL if the
+ * policy needs no state.
+ *
+ * Choices are made for several games at once. choosekeeps() is given
+ * count states, and stores for each one a bitmask of the positions
+ * of the dice to keep; keeping all five dice ends the rolling for the
+ * turn. choosecategories() is given count states, and stores for
+ * each one the open category in which to score the dice.
+ */
+struct yahtzeebot {
+    int version;			/* yahtzeebot_version */
+    char const *name;			/* the policy's name */
+    char const *description;		/* a one-line description */
+    void *(*newplayer)(unsigned long long seed);
+    void (*freeplayer)(void *player);
+    void (*choosekeeps)(void *player, unsigned long long const *states,
+			int *keepmasks, int count);
+    void (*choosecategories)(void *player, unsigned long long const *states,
+			     int *categories, int count);
+};
+
+#endif